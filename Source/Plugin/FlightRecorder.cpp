@@ -0,0 +1,144 @@
+#include "FlightRecorder.h"
+
+FlightRecorder::FlightRecorder()
+: juce::Thread ("CML flight recorder"),
+  outputDir (juce::File::getSpecialLocation (juce::File::userApplicationDataDirectory)
+                 .getChildFile ("Compass").getChildFile ("FlightRecorder"))
+{
+}
+
+FlightRecorder::~FlightRecorder()
+{
+    stopThread (2000);
+}
+
+void FlightRecorder::prepare (double sampleRate)
+{
+    stopThread (2000);
+
+    // A window frozen before this re-prepare is still evidence: flush it before the ring is rebuilt.
+    writePendingDump();
+
+    writePos  = 0;
+    filled    = 0;
+    frameRate = sampleRate;
+
+    pendingTrigger.store (0, std::memory_order_relaxed);
+    frozen.store (false, std::memory_order_release);
+
+    if (! enabled)
+    {
+        // Empty ring: acceptsFrames() is false and freeze() returns immediately.
+        std::vector<Frame>().swap (ring);
+        return;
+    }
+
+    const size_t cap = (size_t) juce::jmax (1, (int) std::ceil (kWindowSec * juce::jmax (1.0, sampleRate)));
+    ring.assign (cap, Frame {});
+
+    if (backgroundWriter)
+        startThread (juce::Thread::Priority::low);
+}
+
+void FlightRecorder::release()
+{
+    stopThread (2000);
+    writePendingDump();
+}
+
+void FlightRecorder::setOutputDirectory (const juce::File& dir)
+{
+    const juce::ScopedLock sl (writerLock);
+    outputDir = dir;
+}
+
+void FlightRecorder::freeze (Trigger t) noexcept
+{
+    if (ring.empty() || filled == 0 || frozen.load (std::memory_order_relaxed))
+        return;
+
+    if (dumpCount.load (std::memory_order_relaxed) >= kMaxDumpsPerSession)
+        return;
+
+    pendingTrigger.store ((std::uint8_t) t, std::memory_order_relaxed);
+    frozen.store (true, std::memory_order_release);
+}
+
+const char* FlightRecorder::triggerName (Trigger t) noexcept
+{
+    switch (t)
+    {
+        case Trigger::NonFiniteMath:  return "nonfinite";
+        case Trigger::OverloadAssist: return "overload";
+        case Trigger::None:           break;
+    }
+    return "none";
+}
+
+juce::File FlightRecorder::writePendingDump()
+{
+    const juce::ScopedLock sl (writerLock);
+
+    if (! frozen.load (std::memory_order_acquire))
+        return {};
+
+    const auto trigger = (Trigger) pendingTrigger.load (std::memory_order_relaxed);
+    juce::File written;
+
+    if (trigger != Trigger::None && filled > 0 && outputDir.createDirectory().wasOk())
+    {
+        const int n = dumpCount.fetch_add (1, std::memory_order_relaxed) + 1;
+        const auto stamp = juce::Time::getCurrentTime().formatted ("%Y%m%d-%H%M%S");
+        auto file = outputDir.getNonexistentChildFile ("cml_flight_" + juce::String (triggerName (trigger))
+                                                           + "_" + stamp + "_" + juce::String (n), ".csv", false);
+
+        juce::FileOutputStream out (file);
+        if (out.openedOk())
+        {
+            out << "# trigger=" << triggerName (trigger)
+                << " frameRateHz=" << frameRate
+                << " frames=" << (int) filled << "\n";
+            out << "frame,detDbL,detDbR,attnTgtDbL,attnTgtDbR,microDbL,microDbR,microVelL,microVelR,"
+                   "macroEL,macroER,link01,guardScalar,gainL,gainR,assist\n";
+
+            // Chronological order: oldest frame first, last frame = moment of freeze.
+            const size_t cap   = ring.size();
+            const size_t start = (filled < cap ? 0 : writePos);
+
+            for (size_t k = 0; k < filled; ++k)
+            {
+                const Frame& f = ring[(start + k) % cap];
+                out << (int) k - (int) filled + 1
+                    << "," << f.detectorDb[0]       << "," << f.detectorDb[1]
+                    << "," << f.attnTargetDb[0]     << "," << f.attnTargetDb[1]
+                    << "," << f.microDb[0]          << "," << f.microDb[1]
+                    << "," << f.microVelDbPerSec[0] << "," << f.microVelDbPerSec[1]
+                    << "," << f.macroEnergy[0]      << "," << f.macroEnergy[1]
+                    << "," << f.link01
+                    << "," << f.guardScalar
+                    << "," << f.outGain[0]          << "," << f.outGain[1]
+                    << "," << (int) ((f.flags & kFlagAssist) != 0u) << "\n";
+            }
+
+            out.flush();
+            written = file;
+        }
+    }
+
+    // Re-arm: audio thread resumes recording into an empty window.
+    writePos = 0;
+    filled   = 0;
+    pendingTrigger.store (0, std::memory_order_relaxed);
+    frozen.store (false, std::memory_order_release);
+
+    return written;
+}
+
+void FlightRecorder::run()
+{
+    while (! threadShouldExit())
+    {
+        wait (kWriterPollMs);
+        writePendingDump();
+    }
+}
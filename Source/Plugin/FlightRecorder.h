@@ -0,0 +1,97 @@
+#pragma once
+#include <juce_core/juce_core.h>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+// Phase 12 — Anomaly Flight Recorder (OPT-IN; off by default: no ring, no thread, no disk)
+// Preallocated ring of per-native-sample internal state (last kWindowSec), frozen on the audio thread
+// when an anomaly fires (non-finite math, overload-assist engagement) and written to disk off the
+// audio thread. Audio thread: push()/freeze() only — no allocation, no locks, no signalling
+// (the writer polls; WaitableEvent::signal would take a mutex on the audio thread).
+// Recording and freezing need no thread: the frozen window waits for writePendingDump() from the owner,
+// unless the optional background writer (B007 exception, diagnostics sessions only) is also enabled.
+class FlightRecorder final : private juce::Thread
+{
+public:
+    enum class Trigger : std::uint8_t
+    {
+        None = 0,
+        NonFiniteMath,
+        OverloadAssist
+    };
+
+    // One frame per native sample (last oversampled sub-sample's state). Control values in dB unless noted.
+    struct Frame final
+    {
+        std::array<float, 2> detectorDb      { 0.0f, 0.0f };   // instantaneous detector level (dBTP-style)
+        std::array<float, 2> attnTargetDb    { 0.0f, 0.0f };   // post floor/hysteresis target
+        std::array<float, 2> microDb         { 0.0f, 0.0f };   // micro envelope position
+        std::array<float, 2> microVelDbPerSec{ 0.0f, 0.0f };   // micro envelope velocity
+        std::array<float, 2> macroEnergy     { 0.0f, 0.0f };   // macro energy state (linear)
+        float                link01          = 0.0f;           // smoothed stereo link
+        float                guardScalar     = 1.0f;           // HF guardrail GR scalar [1, 1.25]
+        std::array<float, 2> outGain         { 1.0f, 1.0f };   // final linear gain (pre ceiling stage)
+        std::uint32_t        flags           = 0u;             // kFlagAssist
+    };
+
+    static constexpr std::uint32_t kFlagAssist = 1u << 0;
+
+    static constexpr double kWindowSec           = 0.30;
+    static constexpr int    kMaxDumpsPerSession  = 16;
+    static constexpr int    kWriterPollMs        = 100;
+
+    FlightRecorder();
+    ~FlightRecorder() override;
+
+    // Message thread (allocates; stops/starts the writer).
+    void prepare (double sampleRate);
+    void release();
+
+    // Configuration (message thread, outside prepare/release; takes effect at the next prepare).
+    // Disabled (default): prepare() frees the ring and every audio-thread hook is a no-op.
+    // Default directory: <userApplicationData>/Compass/FlightRecorder. Without the background writer,
+    // pending dumps are only written by writePendingDump() (deterministic, no scheduling).
+    void setEnabled (bool shouldRecord) noexcept { enabled = shouldRecord; }
+    void setOutputDirectory (const juce::File& dir);
+    void setBackgroundWriter (bool shouldWrite) noexcept { backgroundWriter = shouldWrite; }
+
+    // Audio thread. acceptsFrames() once per block; push() only when it returned true.
+    bool acceptsFrames() const noexcept { return ! ring.empty() && ! frozen.load (std::memory_order_acquire); }
+
+    void push (const Frame& f) noexcept
+    {
+        ring[writePos] = f;
+        if (++writePos >= ring.size()) writePos = 0;
+        if (filled < ring.size()) ++filled;
+    }
+
+    void freeze (Trigger t) noexcept;
+
+    // Non-audio thread: writes the frozen window (if any) and re-arms. Returns the file written, or {}.
+    juce::File writePendingDump();
+
+    int getDumpCount() const noexcept { return dumpCount.load (std::memory_order_relaxed); }
+
+    static const char* triggerName (Trigger t) noexcept;
+
+private:
+    void run() override;
+
+    std::vector<Frame> ring;
+    size_t writePos = 0;
+    size_t filled   = 0;
+    double frameRate = 0.0;
+
+    std::atomic<bool>          frozen { false };
+    std::atomic<std::uint8_t>  pendingTrigger { 0 };
+    std::atomic<int>           dumpCount { 0 };
+
+    juce::CriticalSection writerLock; // writer side only (background thread vs. writePendingDump callers)
+    juce::File outputDir;
+    bool enabled          = false;
+    bool backgroundWriter = false;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (FlightRecorder)
+};
@@ -0,0 +1,135 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace compass
+{
+    // Phase 11 — Meter transport (SPSC, lock-free, tear-free)
+    // Ring of per-slot seqlocks. The producer (audio thread) is the only writer of the slots and of `published`;
+    // the draining consumer (one thread, readNext) is the only writer of its own cursor. readLatest writes nothing,
+    // so any number of threads may poll it alongside the drain. The two counters live on separate cache lines,
+    // so neither side ever dirties a line the other one writes.
+    //
+    // Publication n (0-based, monotonic) goes to slot n % Capacity, stamped 2n+1 while being written and 2n+2
+    // once complete. A reader accepts a copy only when the stamp reads 2n+2 both before and after the copy: a slot
+    // the producer lapped mid-copy is rejected, never returned torn. A full ring overwrites the oldest entries;
+    // the consumer notices the lap from the counters and skips ahead (missed snapshots are acceptable).
+    template <typename T, std::size_t Capacity>
+    class SeqlockRing final
+    {
+        static_assert (std::is_trivially_copyable<T>::value, "slots are copied with plain assignment");
+        static_assert (Capacity > 0, "empty ring");
+
+    public:
+        static constexpr std::size_t kCacheLine = 64;
+
+        // Producer only. Wait-free; no allocation.
+        void publish (const T& value) noexcept
+        {
+            const std::uint64_t n = published.load (std::memory_order_relaxed);
+            Slot& slot = slots[(std::size_t) (n % Capacity)];
+
+            slot.stamp.store (2u * n + 1u, std::memory_order_relaxed);
+            std::atomic_thread_fence (std::memory_order_release);
+            slot.value = value;
+            slot.stamp.store (2u * n + 2u, std::memory_order_release);
+
+            published.store (n + 1u, std::memory_order_release);
+        }
+
+        // Any reader thread. Newest complete entry; leaves the drain cursor alone, so a poll never hides
+        // unread entries from readNext.
+        bool readLatest (T& out) const noexcept
+        {
+            for (int attempt = 0; attempt < kMaxAttempts; ++attempt)
+            {
+                const std::uint64_t end = published.load (std::memory_order_acquire);
+                if (end == 0u)
+                    return false;
+
+                if (tryRead (end - 1u, out))
+                    return true;
+            }
+
+            return false;
+        }
+
+        // Draining consumer only (one thread). Next unread entry in publication order (oldest first). Entries the producer has already
+        // lapped are skipped; returns false when nothing unread remains.
+        bool readNext (T& out) noexcept
+        {
+            for (int attempt = 0; attempt < kMaxAttempts; ++attempt)
+            {
+                const std::uint64_t end = published.load (std::memory_order_acquire);
+                if (consumed >= end)
+                    return false;
+
+                if (end - consumed > (std::uint64_t) Capacity)
+                    consumed = end - (std::uint64_t) Capacity;
+
+                if (tryRead (consumed, out))
+                {
+                    ++consumed;
+                    return true;
+                }
+
+                // Lapped while copying: the oldest entry is gone, move towards the newer ones.
+                ++consumed;
+            }
+
+            return false;
+        }
+
+        // Any reader thread: true once anything has been published since the last reset().
+        bool hasPublished() const noexcept { return published.load (std::memory_order_acquire) != 0u; }
+
+        // Neither side running (prepare/release on the message thread).
+        void reset() noexcept
+        {
+            for (auto& s : slots)
+            {
+                s.stamp.store (0u, std::memory_order_relaxed);
+                s.value = T {};
+            }
+
+            published.store (0u, std::memory_order_release);
+            consumed = 0u;
+        }
+
+    private:
+        static constexpr int kMaxAttempts = 4;
+
+        struct alignas (kCacheLine) Slot final
+        {
+            std::atomic<std::uint64_t> stamp { 0u };
+            T value {};
+        };
+
+        bool tryRead (std::uint64_t n, T& out) const noexcept
+        {
+            const Slot& slot = slots[(std::size_t) (n % Capacity)];
+            const std::uint64_t expected = 2u * n + 2u;
+
+            if (slot.stamp.load (std::memory_order_acquire) != expected)
+                return false;
+
+            T copy = slot.value;
+            std::atomic_thread_fence (std::memory_order_acquire);
+
+            if (slot.stamp.load (std::memory_order_relaxed) != expected)
+                return false;
+
+            out = copy;
+            return true;
+        }
+
+        std::array<Slot, Capacity> slots {};
+
+        alignas (kCacheLine) std::atomic<std::uint64_t> published { 0u }; // producer-owned
+        alignas (kCacheLine) std::uint64_t consumed = 0u;                  // consumer-owned
+    };
+}
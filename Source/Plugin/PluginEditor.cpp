@@ -26,16 +26,71 @@ public:
                            juce::Slider& slider) override
     {
         const auto knobBounds = juce::Rectangle<float> ((float) x, (float) y, (float) width, (float) height);
-        drawMachinedKnob (g, knobBounds, sliderPosProportional, rotaryStartAngle, rotaryEndAngle, slider);
+
+        //// [CML:UI] Knob body cache — static layers rendered once per size/scale; only the indicator is live
+        const float scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+        const KnobBodyCache& body = knobBodyFor (width, height, rotaryStartAngle, rotaryEndAngle, scale);
+        g.drawImage (body.image, knobBounds.expanded (body.padPx));
+
+        drawKnobIndicator (g, knobBounds, sliderPosProportional, rotaryStartAngle, rotaryEndAngle, slider);
     }
 
+    // Editor resize: cached bodies are rebuilt lazily at the new sizes.
+    void invalidateCache() noexcept { knobBodies.clear(); }
+
 private:
-    void drawMachinedKnob (juce::Graphics& g,
-                           juce::Rectangle<float> knobBounds,
-                           float sliderPosProportional,
-                           float rotaryStartAngle,
-                           float rotaryEndAngle,
-                           juce::Slider& slider)
+    struct KnobBodyCache final
+    {
+        int   width  = 0;
+        int   height = 0;
+        float startAngle = 0.0f;
+        float endAngle   = 0.0f;
+        float scale  = 1.0f;
+        float padPx  = 0.0f; // contact shadow reaches past the knob bounds
+        juce::Image image;
+    };
+
+    const KnobBodyCache& knobBodyFor (int width, int height, float rotaryStartAngle, float rotaryEndAngle, float scale)
+    {
+        for (const auto& c : knobBodies)
+            if (c.width == width && c.height == height && c.startAngle == rotaryStartAngle
+                && c.endAngle == rotaryEndAngle && c.scale == scale)
+                return c;
+
+        KnobBodyCache c;
+        c.width      = width;
+        c.height     = height;
+        c.startAngle = rotaryStartAngle;
+        c.endAngle   = rotaryEndAngle;
+        c.scale      = scale;
+        c.padPx      = std::ceil (0.10f * (float) juce::jmin (width, height));
+
+        const auto local = juce::Rectangle<float> (c.padPx, c.padPx, (float) width, (float) height);
+        const auto full  = local.expanded (c.padPx);
+
+        c.image = juce::Image (juce::Image::ARGB,
+                               juce::jmax (1, (int) std::ceil (full.getWidth()  * scale)),
+                               juce::jmax (1, (int) std::ceil (full.getHeight() * scale)),
+                               true,
+                               juce::SoftwareImageType());
+        {
+            juce::Graphics ig (c.image);
+            ig.addTransform (juce::AffineTransform::scale (scale));
+            drawKnobBody (ig, local, rotaryStartAngle, rotaryEndAngle);
+        }
+
+        constexpr size_t kMaxKnobBodies = 16; // a few knobs x a few scale factors
+        if (knobBodies.size() >= kMaxKnobBodies)
+            knobBodies.clear();
+
+        knobBodies.push_back (std::move (c));
+        return knobBodies.back();
+    }
+
+    void drawKnobBody (juce::Graphics& g,
+                       juce::Rectangle<float> knobBounds,
+                       float rotaryStartAngle,
+                       float rotaryEndAngle)
     {
         const float cx = knobBounds.getCentreX();
         const float cy = knobBounds.getCentreY();
@@ -308,6 +363,19 @@ private:
             }
         }
 
+    }
+
+    void drawKnobIndicator (juce::Graphics& g,
+                            juce::Rectangle<float> knobBounds,
+                            float sliderPosProportional,
+                            float rotaryStartAngle,
+                            float rotaryEndAngle,
+                            juce::Slider& slider)
+    {
+        const float cx = knobBounds.getCentreX();
+        const float cy = knobBounds.getCentreY();
+        const float r  = juce::jmin (knobBounds.getWidth(), knobBounds.getHeight()) * 0.5f;
+
         // Indicator (line) — replaces JUCE dot/pointer; mapping unchanged.
         const float angle = rotaryStartAngle
                           + sliderPosProportional * (rotaryEndAngle - rotaryStartAngle);
@@ -343,11 +411,14 @@ private:
             g.fillPath (line, juce::AffineTransform::rotation (angle).translated (cx, cy));
         }
     }
+
+    std::vector<KnobBodyCache> knobBodies;
 };
 
 CompassMasteringLimiterAudioProcessorEditor::CompassMasteringLimiterAudioProcessorEditor (CompassMasteringLimiterAudioProcessor& p)
 : juce::AudioProcessorEditor (&p), processor (p)
 {
+    setOpaque (true); // paint() covers every pixel (static layer); nothing behind the editor is redrawn
     setSize (900, 420);
 
     knobLnf = std::make_unique<CompassKnobLookAndFeel>();
@@ -418,6 +489,12 @@ CompassMasteringLimiterAudioProcessorEditor::CompassMasteringLimiterAudioProcess
     oversamplingMin.addItem ("8x", 3);
     addAndMakeVisible (oversamplingMin);
 
+    //// [CML:UI] Offline oversampling tier — used only for nonrealtime renders
+    oversamplingOffline.addItem ("Same", 1);
+    oversamplingOffline.addItem ("16x", 2);
+    oversamplingOffline.addItem ("32x", 3);
+    addAndMakeVisible (oversamplingOffline);
+
     addAndMakeVisible (grMeter);
     grMeter.setInterceptsMouseClicks (false, false);
     grMeter.toBack();
@@ -477,6 +554,15 @@ CompassMasteringLimiterAudioProcessorEditor::CompassMasteringLimiterAudioProcess
     lufsILabel.setText ("LUFS-I: -120.0", juce::dontSendNotification);
     addAndMakeVisible (lufsILabel);
 
+    //// [CML:UI] CPU load readout — deadline ratio percentiles + assist state (context band)
+    cpuLoadLabel.setJustificationType (juce::Justification::centredRight);
+    cpuLoadLabel.setFont (juce::Font (12.0f));
+    cpuLoadLabel.setColour (juce::Label::textColourId, juce::Colours::white.withAlpha (0.55f));
+    cpuLoadLabel.setColour (juce::Label::backgroundColourId, juce::Colours::transparentBlack);
+    cpuLoadLabel.setInterceptsMouseClicks (false, false);
+    cpuLoadLabel.setText ("CPU: --", juce::dontSendNotification);
+    addAndMakeVisible (cpuLoadLabel);
+
     inPeakLabel.setJustificationType (juce::Justification::centredLeft);
     inPeakLabel.setFont (juce::Font (13.0f));
     inPeakLabel.setColour (juce::Label::textColourId, juce::Colours::white.withAlpha (0.70f));
@@ -541,12 +627,26 @@ CompassMasteringLimiterAudioProcessorEditor::CompassMasteringLimiterAudioProcess
     linkA    = std::make_unique<APVTS::ButtonAttachment> (vts, "stereo_link", stereoLink);
     updateStereoLinkUi();
     osA      = std::make_unique<APVTS::ComboBoxAttachment> (vts, "oversampling_min", oversamplingMin);
+    osOfflineA = std::make_unique<APVTS::ComboBoxAttachment> (vts, "oversampling_offline", oversamplingOffline);
 
-    startTimerHz (30);
+    // Raw parameter handles for the per-frame value readouts (looked up once, not per vblank).
+    readoutParams.trim    = vts.getRawParameterValue ("trim");
+    readoutParams.drive   = vts.getRawParameterValue ("drive");
+    readoutParams.ceiling = vts.getRawParameterValue ("ceiling");
+
+    // The editor is a meter consumer: the audio thread only runs the meter holds/publish while one is open.
+    processor.attachMeterConsumer();
+
+    //// [CML:UI] Meter refresh — display-synchronised, change-driven
+    // Runs on each vblank instead of a free-running timer; a frame with nothing new repaints nothing.
+    vblank = juce::VBlankAttachment (this, [this] { onVBlank(); });
 }
 
 CompassMasteringLimiterAudioProcessorEditor::~CompassMasteringLimiterAudioProcessorEditor()
 {
+    vblank = {};
+    processor.detachMeterConsumer();
+
     drive.setLookAndFeel (nullptr);
     ceiling.setLookAndFeel (nullptr);
     trim.setLookAndFeel (nullptr);
@@ -555,65 +655,184 @@ CompassMasteringLimiterAudioProcessorEditor::~CompassMasteringLimiterAudioProces
 }
 
 
-void CompassMasteringLimiterAudioProcessorEditor::timerCallback()
+// Display-resolution change detection: true (and `shown` updated) when v differs at 0.1 steps.
+static bool tenthsChanged (int& shown, float v) noexcept
+{
+    const int t = juce::roundToInt (v * 10.0f);
+    if (t == shown)
+        return false;
+
+    shown = t;
+    return true;
+}
+
+void CompassMasteringLimiterAudioProcessorEditor::onVBlank()
 {
+    //// [CML:UI] Meter drain — every snapshot published since the last frame
+    // The display refresh and the publish rate (50 Hz) are unrelated: reading only the newest snapshot would
+    // drop the peaks in between. Peaks/GR are max-aggregated over the drain; the timeline gets one point each.
+    CompassMasteringLimiterAudioProcessor::MeterDrain drain;
+    const int drained = processor.drainMeters (drain, meterDrainPoints.data(), (int) meterDrainPoints.size());
+
+    bool grMeterDirty = false;
+    if (drained > 0)
+    {
+        grMeter.pushHistory (meterDrainPoints.data(), juce::jmin (drained, (int) meterDrainPoints.size()));
+        grMeterDirty = true;
+    }
+
     //// [CML:UI] GR magnitude for UI — sign normalization
     constexpr float kGrMinDb = 0.0f;
 
-    const float current = processor.getCurrentGRDb();
-    const float grMagDb = juce::jmax (kGrMinDb, current);
-    lastGrDb = grMagDb;
+    // Frames with nothing new keep the last drained max-hold: falling back to the per-tile value would make the
+    // LEDs and the readout alternate between two readings whenever the display outpaces the publish rate.
+    if (drained > 0)
+        lastGrDb = juce::jmax (kGrMinDb, drain.grDb);
+
+    const float grMagDb = lastGrDb;
 
-    grMeter.pushValueDb (grMagDb);
-    currentGrLabel.setText (juce::String::formatted ("%.1f dB", grMagDb), juce::dontSendNotification);
+    grMeterDirty = grMeter.pushValueDb (grMagDb) || grMeterDirty;
+    if (grMeterDirty)
+        grMeter.repaint();
+
+    // Only the tab value text is live in the editor's own paint (the rest is the static layer).
+    if (tenthsChanged (shownTenths[kShownGr], grMagDb))
+    {
+        currentGrLabel.setText (juce::String::formatted ("%.1f dB", grMagDb), juce::dontSendNotification);
+        repaint (grTabArea().getSmallestIntegerContainer());
+    }
 
     // Top rotary value readouts (APVTS raw values)
-    auto& vts = processor.getAPVTS();
-    const float trimDb   = vts.getRawParameterValue ("trim")->load();
-    const float glueDb   = vts.getRawParameterValue ("drive")->load();
-    const float ceilDbTP = vts.getRawParameterValue ("ceiling")->load();
+    const float trimDb   = readoutParams.trim->load();
+    const float glueDb   = readoutParams.drive->load();
+    const float ceilDbTP = readoutParams.ceiling->load();
 
-    trimValueLabel.setText    (juce::String::formatted ("%.1f dB",   trimDb),   juce::dontSendNotification);
-    glueValueLabel.setText    (juce::String::formatted ("%.1f dB",   glueDb),   juce::dontSendNotification);
-    ceilingValueLabel.setText (juce::String::formatted ("%.1f dBTP", ceilDbTP), juce::dontSendNotification);
+    if (tenthsChanged (shownTenths[kShownTrim], trimDb))
+        trimValueLabel.setText    (juce::String::formatted ("%.1f dB",   trimDb),   juce::dontSendNotification);
+    if (tenthsChanged (shownTenths[kShownGlue], glueDb))
+        glueValueLabel.setText    (juce::String::formatted ("%.1f dB",   glueDb),   juce::dontSendNotification);
+    if (tenthsChanged (shownTenths[kShownCeiling], ceilDbTP))
+        ceilingValueLabel.setText (juce::String::formatted ("%.1f dBTP", ceilDbTP), juce::dontSendNotification);
 
-        //// [CML:UI] Stereo TP Meter Feed — L/R Values
-    float inL = -120.0f, inR = -120.0f;
-    float outL = -120.0f, outR = -120.0f;
+    if (drained == 0)
+        return;
 
-    if (processor.getCurrentTruePeakDbTP_LR (inL, inR, outL, outR))
+        //// [CML:UI] Stereo TP Meter Feed — L/R Values (max over the drain)
     {
-        inTpMeter.pushValueDbLR (inL, inR);
-        outTpMeter.pushValueDbLR (outL, outR);
-        inTpMeter.repaint();
-        outTpMeter.repaint();
-
-        inTpLabel.setText  (juce::String::formatted ("IN TP: %.1f / %.1f",  inL,  inR),  juce::dontSendNotification);
-        outTpLabel.setText (juce::String::formatted ("OUT TP: %.1f / %.1f", outL, outR), juce::dontSendNotification);
+        const float inL  = juce::jlimit (-120.0f, 60.0f, drain.inTpDb[0]);
+        const float inR  = juce::jlimit (-120.0f, 60.0f, drain.inTpDb[1]);
+        const float outL = juce::jlimit (-120.0f, 60.0f, drain.outTpDb[0]);
+        const float outR = juce::jlimit (-120.0f, 60.0f, drain.outTpDb[1]);
+
+        if (inTpMeter.pushValueDbLR (inL, inR))
+            inTpMeter.repaint();
+        if (outTpMeter.pushValueDbLR (outL, outR))
+            outTpMeter.repaint();
+
+        // Both sides always update their shown value (no short-circuit).
+        const bool inLChanged  = tenthsChanged (shownTenths[kShownInL],  inL);
+        const bool inRChanged  = tenthsChanged (shownTenths[kShownInR],  inR);
+        const bool outLChanged = tenthsChanged (shownTenths[kShownOutL], outL);
+        const bool outRChanged = tenthsChanged (shownTenths[kShownOutR], outR);
+
+        if (inLChanged || inRChanged)
+            inTpLabel.setText  (juce::String::formatted ("IN TP: %.1f / %.1f",  inL,  inR),  juce::dontSendNotification);
+        if (outLChanged || outRChanged)
+            outTpLabel.setText (juce::String::formatted ("OUT TP: %.1f / %.1f", outL, outR), juce::dontSendNotification);
+
+        const float lufsS = juce::jmax (-120.0f, drain.lufsShortDb);
+        const float lufsI = juce::jmax (-120.0f, drain.lufsIntDb);
+
+        if (tenthsChanged (shownTenths[kShownLufsS], lufsS))
+            lufsSLabel.setText (juce::String::formatted ("LUFS-S: %.1f", lufsS), juce::dontSendNotification);
+        if (tenthsChanged (shownTenths[kShownLufsI], lufsI))
+            lufsILabel.setText (juce::String::formatted ("LUFS-I: %.1f", lufsI), juce::dontSendNotification);
     }
-    float lufsS = -120.0f;
-    float lufsI = -120.0f;
-    if (processor.getCurrentLufsDb (lufsS, lufsI))
+
+    //// [CML:UI] CPU load readout — near-deadline instances flagged (DEGRADE Ln = overload tier in effect)
     {
-        lufsS = juce::jmax (-120.0f, lufsS);
-        lufsI = juce::jmax (-120.0f, lufsI);
+        const auto& cpu = drain.cpu;
+        const bool warn = (cpu.assistActive || cpu.p99 >= 0.85f);
+
+        const std::array<int, 6> key { juce::roundToInt (cpu.p50 * 100.0f),
+                                       juce::roundToInt (cpu.p99 * 100.0f),
+                                       juce::roundToInt (cpu.max * 100.0f),
+                                       (int) cpu.deadlineMisses,
+                                       cpu.overloadLevel,
+                                       warn ? 1 : 0 };
+        if (key != shownCpu)
+        {
+            shownCpu = key;
+
+            const juce::String text = juce::String::formatted ("CPU p50 %d%%  p99 %d%%  max %d%%", key[0], key[1], key[2])
+                                    + (cpu.deadlineMisses > 0 ? juce::String::formatted ("  miss %u", (unsigned int) cpu.deadlineMisses) : juce::String())
+                                    + (cpu.overloadLevel > 0 ? juce::String::formatted ("  DEGRADE L%d", cpu.overloadLevel) : juce::String());
+
+            cpuLoadLabel.setText (text, juce::dontSendNotification);
+            cpuLoadLabel.setColour (juce::Label::textColourId,
+                                    warn ? juce::Colours::orange.withAlpha (0.90f)
+                                         : juce::Colours::white.withAlpha (0.55f));
+        }
+    }
+}
 
-        lufsSLabel.setText (juce::String::formatted ("LUFS-S: %.1f", lufsS), juce::dontSendNotification);
-        lufsILabel.setText (juce::String::formatted ("LUFS-I: %.1f", lufsI), juce::dontSendNotification);
+void CompassMasteringLimiterAudioProcessorEditor::paint (juce::Graphics& g)
+{
+    //// [CML:UI] Static layer cache — rendered once per size/scale (resized() invalidates)
+    const float scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+    if (! staticLayer.isValid() || staticLayerScale != scale)
+    {
+        staticLayerScale = scale;
+        staticLayer = juce::Image (juce::Image::RGB,
+                                   juce::jmax (1, (int) std::ceil ((float) getWidth()  * scale)),
+                                   juce::jmax (1, (int) std::ceil ((float) getHeight() * scale)),
+                                   false,
+                                   juce::SoftwareImageType());
+
+        juce::Graphics sg (staticLayer);
+        sg.addTransform (juce::AffineTransform::scale (scale));
+        paintStaticLayer (sg);
     }
 
-    float inPk = -120.0f;
-    float outPk = -120.0f;
-    if (processor.getCurrentPeakDbFS (inPk, outPk))
+    g.drawImage (staticLayer, getLocalBounds().toFloat());
+
+    //// [CML:UI] GR header tab — live value (the only per-frame text in the editor's own paint)
     {
-        inPk = juce::jmax (-120.0f, inPk);
-        outPk = juce::jmax (-120.0f, outPk);
+        constexpr float kValueFontPx   = 16.0f;
+        constexpr float kValueAlpha    = 0.85f;
+
+        const auto tab = grTabArea();
+        auto tabBot = tab.withTrimmedTop (tab.getHeight() * 0.5f);
+
+        const float grMagDb = juce::jmax (0.0f, lastGrDb);
+
+        g.setColour (juce::Colours::white.withAlpha (kValueAlpha));
+        g.setFont (juce::Font (kValueFontPx, juce::Font::bold));
+        g.drawText (juce::String::formatted ("%.1f dB", grMagDb),
+                    tabBot.toNearestInt(),
+                    juce::Justification::centred,
+                    false);
     }
+}
 
-    repaint (grFullBounds);
+juce::Rectangle<float> CompassMasteringLimiterAudioProcessorEditor::grTabArea() const noexcept
+{
+    // Header tab centered above the well (reference-style)
+    constexpr float kTabWidthFrac = 0.18f;
+    constexpr float kTabHeightPx  = 32.0f;
+    constexpr float kTabRiseFrac  = 0.72f;
+
+    const auto well = grWellBounds.toFloat();
+
+    const float tabW = well.getWidth() * kTabWidthFrac;
+    const float tabH = kTabHeightPx;
+    return juce::Rectangle<float> (well.getCentreX() - 0.5f * tabW,
+                                   well.getY() - (tabH * kTabRiseFrac),
+                                   tabW,
+                                   tabH);
 }
 
-void CompassMasteringLimiterAudioProcessorEditor::paint (juce::Graphics& g)
+void CompassMasteringLimiterAudioProcessorEditor::paintStaticLayer (juce::Graphics& g)
 {
     g.fillAll (juce::Colours::black);
 
@@ -624,11 +843,7 @@ void CompassMasteringLimiterAudioProcessorEditor::paint (juce::Graphics& g)
 
     //// [CML:UI] GR module framing — well + tab (plate removed)
     {
-        // Compute geometry (derived from stored rectangles; no magic outside this block)
-        constexpr float kTabWidthFrac = 0.18f;
-        constexpr float kTabHeightPx  = 32.0f;
-        constexpr float kTabRiseFrac  = 0.72f;
-
+        // Compute geometry (derived from stored rectangles; tab geometry lives in grTabArea)
         constexpr float kWellCornerPx  = 8.0f;
         constexpr float kWellTopA      = 0.62f;
         constexpr float kWellBotA      = 0.92f;
@@ -636,16 +851,7 @@ void CompassMasteringLimiterAudioProcessorEditor::paint (juce::Graphics& g)
         constexpr float kWellStrokeLoA = 0.55f;
 
         auto well = grWellBounds.toFloat();
-
-        // Header tab centered above the well (reference-style)
-        const float tabW = well.getWidth() * kTabWidthFrac;
-        const float tabH = kTabHeightPx;
-        auto tab = juce::Rectangle<float> (
-            well.getCentreX() - 0.5f * tabW,
-            well.getY() - (tabH * kTabRiseFrac),
-            tabW,
-            tabH
-        );
+        auto tab  = grTabArea();
 
         // Inner well floor only (plate/cavity removed per Phase 3 Option B)
         {
@@ -669,16 +875,12 @@ void CompassMasteringLimiterAudioProcessorEditor::paint (juce::Graphics& g)
             constexpr float kTabCornerPx   = 8.0f;
             constexpr float kTabStrokePx   = 1.0f;
             constexpr float kTitleFontPx   = 22.0f;
-            constexpr float kValueFontPx   = 16.0f;
             constexpr float kTitleAlpha    = 0.90f;
-            constexpr float kValueAlpha    = 0.85f;
 
             constexpr float kTabTopA       = 0.07f;
             constexpr float kTabBotA       = 0.62f;
             constexpr float kTabStrokeA    = 0.07f;
 
-            const float grMagDb = juce::jmax (0.0f, lastGrDb);
-
             juce::ColourGradient tabGrad (juce::Colours::white.withAlpha (kTabTopA),
                                           tab.getCentreX(), tab.getY(),
                                           juce::Colours::black.withAlpha (kTabBotA),
@@ -691,18 +893,10 @@ void CompassMasteringLimiterAudioProcessorEditor::paint (juce::Graphics& g)
             g.drawRoundedRectangle (tab, kTabCornerPx, kTabStrokePx);
 
             auto tabTop  = tab.withHeight (tab.getHeight() * 0.5f);
-            auto tabBot  = tab.withTrimmedTop (tab.getHeight() * 0.5f);
 
             g.setColour (juce::Colours::white.withAlpha (kTitleAlpha));
             g.setFont (juce::Font (kTitleFontPx, juce::Font::bold));
             g.drawText ("GR", tabTop.toNearestInt(), juce::Justification::centred, false);
-
-            g.setColour (juce::Colours::white.withAlpha (kValueAlpha));
-            g.setFont (juce::Font (kValueFontPx, juce::Font::bold));
-            g.drawText (juce::String::formatted ("%.1f dB", grMagDb),
-                        tabBot.toNearestInt(),
-                        juce::Justification::centred,
-                        false);
         }
     }
 
@@ -748,10 +942,16 @@ void CompassMasteringLimiterAudioProcessorEditor::paint (juce::Graphics& g)
 
     drawLabelAbove (stereoLink,      "Stereo Link");
     drawLabelAbove (oversamplingMin, "Oversampling Min");
+    drawLabelAbove (oversamplingOffline, "Offline OS");
 }
 
 void CompassMasteringLimiterAudioProcessorEditor::resized()
 {
+    // Cached layers are size-bound: rebuilt lazily on the next paint.
+    staticLayer = {};
+    if (knobLnf != nullptr)
+        knobLnf->invalidateCache();
+
     // Local geometry constants (single source of truth for this layout function)
     const int knobSize        = 135;
     const int knobGap         = 8;
@@ -849,8 +1049,19 @@ void CompassMasteringLimiterAudioProcessorEditor::resized()
         ceilingValueLabel.setBounds (valueArea);
     }
 
-    // Context band (reserved)
-    (void) bandContext;
+    //// [CML:UI] Context band — oversampling selectors (realtime min + offline tier), label drawn above
+    {
+        const int osComboW   = 96;
+        const int osComboH   = 22;
+        const int osComboGap = 16;
+
+        auto ctx = bandContext.withTrimmedTop (bandContext.getHeight() - osComboH);
+        oversamplingMin.setBounds (ctx.removeFromLeft (osComboW));
+        ctx.removeFromLeft (osComboGap);
+        oversamplingOffline.setBounds (ctx.removeFromLeft (osComboW));
+
+        cpuLoadLabel.setBounds (bandContext.withTrimmedLeft (2 * osComboW + osComboGap).withTrimmedTop (bandContext.getHeight() - osComboH));
+    }
 
     // GR band: header + bar + breathing
     auto grHeader  = bandGR.removeFromTop (48);
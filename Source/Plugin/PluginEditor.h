@@ -1,6 +1,8 @@
 #pragma once
 #include <juce_gui_basics/juce_gui_basics.h>
+#include <array>
 #include <cmath>
+#include <limits>
 #include "PluginProcessor.h"
 
 namespace Layout
@@ -30,62 +32,189 @@ namespace Layout
 class GRHistoryMeter final : public juce::Component
 {
 public:
-    void pushValueDb (float grDb) noexcept
+    // Returns true when the lit bar count changed (the only thing a new value changes on screen).
+    bool pushValueDb (float grDb) noexcept
     {
         if (! std::isfinite (grDb)) grDb = 0.0f;
 
         // UI contract: GR is stereo authority in positive dB (0..range).
-        constexpr float kRangeDb = 24.0f;
-        lastGrDb = juce::jlimit (0.0f, kRangeDb, grDb);
+        lastGrDb = juce::jlimit (0.0f, kGrRangeDb, grDb);
+
+        const int lit = litBarsFor (lastGrDb);
+        if (lit == litBars)
+            return false;
+
+        litBars = lit;
+        return true;
+    }
+
+    using HistoryPoint = CompassMasteringLimiterAudioProcessor::MeterHistoryPoint;
+
+    //// [CML:UI] GR/TP/LUFS timeline — fixed history ring, cached image scrolled one column per point
+    // Points arrive oldest first (one per published snapshot). The cached image is shifted left by n columns
+    // and only the n new columns are drawn; the full history is redrawn only when the size changes.
+    void pushHistory (const HistoryPoint* points, int n)
+    {
+        if (points == nullptr || n <= 0)
+            return;
+
+        for (int k = 0; k < n; ++k)
+        {
+            history[(size_t) historyWrite] = points[k];
+            historyWrite = (historyWrite + 1) % kHistoryCapacity;
+            historyCount = juce::jmin (historyCount + 1, kHistoryCapacity);
+        }
+
+        if (! timeline.isValid())
+            return;
+
+        const int w = timeline.getWidth();
+        const int h = timeline.getHeight();
+        const int shift = juce::jmin (n, historyCount) * kColumnPx;
+
+        if (shift >= w)
+        {
+            rebuildTimeline();
+            return;
+        }
+
+        timeline.moveImageSection (0, 0, shift, 0, w - shift, h);
+        timeline.clear ({ w - shift, 0, shift, h });
+
+        juce::Graphics tg (timeline);
+        for (int i = shift / kColumnPx - 1; i >= 0; --i)
+            drawTimelineColumn (tg, w - (i + 1) * kColumnPx, i);
+    }
+
+    void resized() override
+    {
+        layoutLeds();
+
+        const int w = getWidth();
+        const int h = getHeight();
+
+        if (w <= 0 || h <= 0)
+        {
+            timeline = {};
+            return;
+        }
+
+        if (timeline.isValid() && timeline.getWidth() == w && timeline.getHeight() == h)
+            return;
+
+        timeline = juce::Image (juce::Image::ARGB, w, h, true, juce::SoftwareImageType());
+        rebuildTimeline();
     }
 
     void paint (juce::Graphics& g) override
     {
-        //// [CML:UI] GR meter LEDs only — paint-owned segments
-        auto r = getLocalBounds().toFloat();
+        if (timeline.isValid())
+            g.drawImageAt (timeline, 0, 0);
 
-        //// [CML:UI] GR meter optical segments — dense continuous scale (adaptive fit)
-        constexpr float kInsetXPx        = 18.0f;
-        constexpr float kInsetYPx        = 18.0f;
-        constexpr int   kBarsMax         = 120;
-        constexpr float kGapPx           = 1.0f;
-        constexpr float kMinBarWPx       = 1.0f;
-        constexpr float kRangeDb         = 24.0f;
+        //// [CML:UI] GR meter LEDs — cached lit/unlit strips, split at the lit edge
+        const float scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+        if (! ledUnlit.isValid() || ledScale != scale)
+            renderLedCaches (scale);
 
-        // Professional palette compression (desaturated; no neon/primaries)
-        constexpr float kDesatMix01       = 0.42f; // 0=full hue, 1=grey
-        constexpr float kActiveAlphaTop   = 0.52f;
-        constexpr float kActiveAlphaBot   = 0.42f;
-        constexpr float kInactAlphaTop    = 0.14f;
-        constexpr float kInactAlphaBot    = 0.18f;
+        if (! ledUnlit.isValid())
+            return;
 
-        const juce::Colour cAmber = juce::Colour::fromFloatRGBA (0.80f, 0.58f, 0.22f, 1.0f);
-        const juce::Colour cYell  = juce::Colour::fromFloatRGBA (0.78f, 0.76f, 0.36f, 1.0f);
-        const juce::Colour cGreen = juce::Colour::fromFloatRGBA (0.34f, 0.70f, 0.46f, 1.0f);
-        const juce::Colour cGrey  = juce::Colour::fromFloatRGBA (0.62f, 0.62f, 0.62f, 1.0f);
+        const auto full = getLocalBounds().toFloat();
+        const int splitX = (int) std::floor (ledArea.getX() + (float) litBars * (barW + kGapPx) - 0.5f * kGapPx + 0.5f);
 
-        auto ledArea = r.reduced (kInsetXPx, kInsetYPx);
+        {
+            juce::Graphics::ScopedSaveState ss (g);
+            if (g.reduceClipRegion (getLocalBounds().withLeft (splitX)))
+                g.drawImage (ledUnlit, full);
+        }
+
+        if (litBars > 0)
+        {
+            juce::Graphics::ScopedSaveState ss (g);
+            if (g.reduceClipRegion (getLocalBounds().withRight (splitX)))
+                g.drawImage (ledLit, full);
+        }
+    }
+
+private:
+    static constexpr int   kHistoryCapacity = 2048; // points; >= widest timeline / kColumnPx
+    static constexpr int   kColumnPx        = 1;
+    static constexpr float kGrRangeDb       = 24.0f;
+
+    //// [CML:UI] GR meter optical segments — dense continuous scale (adaptive fit)
+    static constexpr float kInsetXPx        = 18.0f;
+    static constexpr float kInsetYPx        = 18.0f;
+    static constexpr int   kBarsMax         = 120;
+    static constexpr float kGapPx           = 1.0f;
+    static constexpr float kMinBarWPx       = 1.0f;
+
+    void layoutLeds() noexcept
+    {
+        ledArea = getLocalBounds().toFloat().reduced (kInsetXPx, kInsetYPx);
 
         // Choose a bar count that fits deterministically (prevents overflow when width is tight).
         const float ledW = juce::jmax (0.0f, ledArea.getWidth());
         const float denom = (kMinBarWPx + kGapPx);
         const int barsFit = (denom > 0.0f) ? (int) std::floor ((ledW + kGapPx) / denom) : kBarsMax;
-        const int bars = juce::jlimit (1, kBarsMax, barsFit);
+        bars = juce::jlimit (1, kBarsMax, barsFit);
 
         const float totalGapW = kGapPx * (float) (bars - 1);
         const float rawBarW   = (ledW - totalGapW) / (float) bars;
-        const float barW      = juce::jmax (kMinBarWPx, rawBarW);
+        barW = juce::jmax (kMinBarWPx, rawBarW);
+
+        litBars = litBarsFor (lastGrDb);
+
+        ledLit   = {};
+        ledUnlit = {};
+    }
+
+    int litBarsFor (float grDb) const noexcept
+    {
+        const float grNorm = juce::jlimit (0.0f, 1.0f, grDb / kGrRangeDb);
+        return (int) std::floor (grNorm * (float) bars + 0.5f);
+    }
+
+    void renderLedCaches (float scale)
+    {
+        const int w = getWidth();
+        const int h = getHeight();
+        ledScale = scale;
+
+        if (w <= 0 || h <= 0)
+            return;
+
+        const int iw = juce::jmax (1, (int) std::ceil ((float) w * scale));
+        const int ih = juce::jmax (1, (int) std::ceil ((float) h * scale));
+
+        for (auto* img : { &ledLit, &ledUnlit })
+        {
+            *img = juce::Image (juce::Image::ARGB, iw, ih, true, juce::SoftwareImageType());
+
+            juce::Graphics ig (*img);
+            ig.addTransform (juce::AffineTransform::scale (scale));
+            drawLedBars (ig, img == &ledLit);
+        }
+    }
 
-        const float grNorm = juce::jlimit (0.0f, 1.0f, lastGrDb / kRangeDb);
-        const int lit = (int) std::floor (grNorm * (float) bars + 0.5f);
+    void drawLedBars (juce::Graphics& g, bool isActive) const
+    {
+        // Professional palette compression (desaturated; no neon/primaries)
+        constexpr float kDesatMix01       = 0.42f; // 0=full hue, 1=grey
+        constexpr float kActiveAlphaTop   = 0.52f;
+        constexpr float kActiveAlphaBot   = 0.42f;
+        constexpr float kInactAlphaTop    = 0.14f;
+        constexpr float kInactAlphaBot    = 0.18f;
+
+        const juce::Colour cAmber = juce::Colour::fromFloatRGBA (0.80f, 0.58f, 0.22f, 1.0f);
+        const juce::Colour cYell  = juce::Colour::fromFloatRGBA (0.78f, 0.76f, 0.36f, 1.0f);
+        const juce::Colour cGreen = juce::Colour::fromFloatRGBA (0.34f, 0.70f, 0.46f, 1.0f);
+        const juce::Colour cGrey  = juce::Colour::fromFloatRGBA (0.62f, 0.62f, 0.62f, 1.0f);
 
         for (int i = 0; i < bars; ++i)
         {
             const float x = ledArea.getX() + (float) i * (barW + kGapPx);
             juce::Rectangle<float> b (x, ledArea.getY(), barW, ledArea.getHeight());
 
-            const bool isActive = (i < lit);
-
             // Ramp position across the full scale (amber -> yellow -> soft green)
             const float t = (bars > 1) ? ((float) i / (float) (bars - 1)) : 0.0f;
 
@@ -114,15 +243,94 @@ public:
             g.fillRect (b);
         }
     }
+    static constexpr float kLevelFloorDb    = -36.0f; // TP / LUFS-S trace scale
+    static constexpr float kLevelCeilDb     = 3.0f;
+
+    // i = 0 is the newest point.
+    const HistoryPoint& pointAgo (int i) const noexcept
+    {
+        return history[(size_t) ((historyWrite - 1 - i + 2 * kHistoryCapacity) % kHistoryCapacity)];
+    }
+
+    void rebuildTimeline()
+    {
+        if (! timeline.isValid())
+            return;
+
+        timeline.clear (timeline.getBounds());
+
+        const int w = timeline.getWidth();
+        const int cols = juce::jmin (historyCount, w / kColumnPx);
+
+        juce::Graphics tg (timeline);
+        for (int i = cols - 1; i >= 0; --i)
+            drawTimelineColumn (tg, w - (i + 1) * kColumnPx, i);
+    }
+
+    // Column for pointAgo(i): GR as a bar hanging from the top, TP and LUFS-S as traces joined to the
+    // previous point (vertical span inside the column keeps the trace continuous).
+    void drawTimelineColumn (juce::Graphics& tg, int x, int i) const
+    {
+        constexpr float kGrAlpha01   = 0.30f;
+        constexpr float kTpAlpha01   = 0.55f;
+        constexpr float kLufsAlpha01 = 0.45f;
+
+        const juce::Colour cAmber = juce::Colour::fromFloatRGBA (0.80f, 0.58f, 0.22f, 1.0f);
+        const juce::Colour cGreen = juce::Colour::fromFloatRGBA (0.34f, 0.70f, 0.46f, 1.0f);
+
+        const int h = timeline.getHeight();
+        const HistoryPoint& p    = pointAgo (i);
+        const HistoryPoint& prev = (i + 1 < historyCount ? pointAgo (i + 1) : p);
+
+        const float gr01 = juce::jlimit (0.0f, 1.0f, p.grDb / kGrRangeDb);
+        const int grH = (int) std::floor (gr01 * (float) h + 0.5f);
+        if (grH > 0)
+        {
+            tg.setColour (cAmber.withAlpha (kGrAlpha01));
+            tg.fillRect (x, 0, kColumnPx, grH);
+        }
+
+        auto levelY = [h] (float db) noexcept
+        {
+            if (! std::isfinite (db)) db = kLevelFloorDb;
+            const float v01 = juce::jlimit (0.0f, 1.0f, (db - kLevelFloorDb) / (kLevelCeilDb - kLevelFloorDb));
+            return (int) std::floor ((float) (h - 1) * (1.0f - v01) + 0.5f);
+        };
+
+        auto trace = [&] (float db, float prevDb, juce::Colour c)
+        {
+            const int y0 = levelY (db);
+            const int y1 = levelY (prevDb);
+            tg.setColour (c);
+            tg.fillRect (x, juce::jmin (y0, y1), kColumnPx, std::abs (y1 - y0) + 1);
+        };
+
+        trace (p.lufsShortDb, prev.lufsShortDb, cGreen.withAlpha (kLufsAlpha01));
+        trace (p.outTpDb,     prev.outTpDb,     juce::Colours::white.withAlpha (kTpAlpha01));
+    }
 
-private:
     float lastGrDb = 0.0f;
+
+    juce::Rectangle<float> ledArea;
+    int   bars    = 1;
+    float barW    = kMinBarWPx;
+    int   litBars = 0;
+
+    juce::Image ledLit, ledUnlit; // full-size strips at ledScale; rebuilt on resize / scale change
+    float ledScale = 0.0f;
+
+    std::array<HistoryPoint, (size_t) kHistoryCapacity> history {};
+    int historyWrite = 0;
+    int historyCount = 0;
+
+    juce::Image timeline; // software image: scrolling is a memmove, never a GPU readback
 };
 
 class StereoVerticalLedMeter final : public juce::Component
 {
 public:
-    void pushValueDbLR (float lDb, float rDb) noexcept
+    // Returns true when something visible changed (lit segment count or hold line).
+    bool pushValueDbLR (float lDb, float rDb) noexcept
     {
         if (! std::isfinite (lDb)) lDb = kDbFloorDb;
         if (! std::isfinite (rDb)) rDb = kDbFloorDb;
@@ -130,11 +338,17 @@ public:
         lDb = juce::jlimit (kDbFloorDb, kDbCeilDb, lDb);
         rDb = juce::jlimit (kDbFloorDb, kDbCeilDb, rDb);
 
+        const float prevHeld[2] = { heldDb[0], heldDb[1] };
+        const int   prevLit[2]  = { litSegmentsFor (currentDb[0]), litSegmentsFor (currentDb[1]) };
+
         currentDb[0] = lDb;
         currentDb[1] = rDb;
 
         if (lDb > heldDb[0]) heldDb[0] = lDb;
         if (rDb > heldDb[1]) heldDb[1] = rDb;
+
+        return prevHeld[0] != heldDb[0] || prevHeld[1] != heldDb[1]
+            || prevLit[0] != litSegmentsFor (lDb) || prevLit[1] != litSegmentsFor (rDb);
     }
 
     void updatePeakHoldDecay() noexcept
@@ -149,30 +363,88 @@ public:
         }
     }
 
+    void resized() override
+    {
+        layoutLanes();
+        background = {};
+        litStrip   = {};
+    }
+
     void paint (juce::Graphics& g) override
     {
-        //// [CML:UI] Stereo TP Meter LEDs — L/R Lanes
-        auto r = getLocalBounds().toFloat();
+        //// [CML:UI] Stereo TP Meter LEDs — cached frame/scale/unlit layer + cached lit layer
+        // Only the lit spans (clipped) and the hold lines are composed per paint.
+        const float scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+        if (! background.isValid() || cacheScale != scale)
+            renderCaches (scale);
 
-        constexpr float kBgStrokeAlpha01 = 0.09f;
-        constexpr float kBgStrokePx      = 1.0f;
-        constexpr float kCornerPx        = 6.0f;
+        if (! background.isValid())
+            return;
 
-        constexpr float kInsetXPx        = 10.0f;
-        constexpr float kInsetYPx        = 10.0f;
+        const auto full = getLocalBounds().toFloat();
+        const juce::Rectangle<int> litL = litSpan (laneL, litSegmentsFor (currentDb[0]));
+        const juce::Rectangle<int> litR = litSpan (laneR, litSegmentsFor (currentDb[1]));
 
-        constexpr int   kSegN            = 44;
-        constexpr float kSegGapPx        = 1.0f;
+        {
+            juce::Graphics::ScopedSaveState ss (g);
+            g.excludeClipRegion (litL);
+            g.excludeClipRegion (litR);
+            g.drawImage (background, full);
+        }
 
-        constexpr float kLaneGapPx       = 6.0f;
-        constexpr float kMinSegHPx       = 1.0f;
+        for (const auto& span : { litL, litR })
+        {
+            if (span.isEmpty())
+                continue;
 
-        constexpr float kActiveAlpha01   = 0.70f;
-        constexpr float kInactiveAlpha01 = 0.12f;
+            juce::Graphics::ScopedSaveState ss (g);
+            if (g.reduceClipRegion (span))
+                g.drawImage (litStrip, full);
+        }
 
-        g.setColour (juce::Colours::white.withAlpha (kBgStrokeAlpha01));
-        g.drawRoundedRectangle (r, kCornerPx, kBgStrokePx);
+        auto drawHold = [&] (juce::Rectangle<float> lane, int ch)
+        {
+            const float h01 = juce::jlimit (0.0f, 1.0f, (heldDb[ch] - kDbFloorDb) / kDbSpanDb);
+            const float yHold = lane.getBottom() - lane.getHeight() * h01;
 
+            g.setColour (juce::Colours::white);
+            g.drawLine (lane.getX(), yHold, lane.getRight(), yHold, 1.0f);
+        };
+
+        drawHold (laneL, 0);
+        drawHold (laneR, 1);
+    }
+
+private:
+    static constexpr float kDbFloorDb = -120.0f;
+    static constexpr float kDbCeilDb  = 6.0f;
+    static constexpr float kDbSpanDb  = (kDbCeilDb - kDbFloorDb);
+
+    static constexpr float kBgStrokeAlpha01 = 0.09f;
+    static constexpr float kBgStrokePx      = 1.0f;
+    static constexpr float kCornerPx        = 6.0f;
+
+    static constexpr float kInsetXPx        = 10.0f;
+    static constexpr float kInsetYPx        = 10.0f;
+
+    static constexpr int   kSegN            = 44;
+    static constexpr float kSegGapPx        = 1.0f;
+
+    static constexpr float kLaneGapPx       = 6.0f;
+    static constexpr float kMinSegHPx       = 1.0f;
+
+    static constexpr float kActiveAlpha01   = 0.70f;
+    static constexpr float kInactiveAlpha01 = 0.12f;
+
+    static int litSegmentsFor (float db) noexcept
+    {
+        const float v01 = juce::jlimit (0.0f, 1.0f, (db - kDbFloorDb) / kDbSpanDb);
+        return (int) (v01 * (float) kSegN + 0.5f);
+    }
+
+    void layoutLanes() noexcept
+    {
+        auto r = getLocalBounds().toFloat();
         auto a = r.reduced (kInsetXPx, kInsetYPx);
 
         //// [CML:UI] Meter Scale Strip — Shared L/R (Adaptive Width)
@@ -186,10 +458,11 @@ public:
         constexpr float kMinLanesAreaWPx       = 2.0f * kMinLaneWPx + kLaneGapPx;
 
         auto lanesArea = a;
-        juce::Rectangle<float> scaleL, scaleR;
+        scaleL = {};
+        scaleR = {};
 
-        bool drawScaleTicks = false;
-        bool drawScaleText  = false;
+        drawScaleTicks = false;
+        drawScaleText  = false;
 
         const float minNeedW = 2.0f * kMinScaleStripWPx + 2.0f * kScaleGapPx + kMinLanesAreaWPx;
         if (lanesArea.getWidth() >= minNeedW)
@@ -208,81 +481,118 @@ public:
         }
 
         const float laneW = (lanesArea.getWidth() - kLaneGapPx) * 0.5f;
-        auto laneL = juce::Rectangle<float> (lanesArea.getX(), a.getY(), laneW, a.getHeight());
-        auto laneR = juce::Rectangle<float> (lanesArea.getX() + laneW + kLaneGapPx, a.getY(), laneW, a.getHeight());
+        laneL = juce::Rectangle<float> (lanesArea.getX(), a.getY(), laneW, a.getHeight());
+        laneR = juce::Rectangle<float> (lanesArea.getX() + laneW + kLaneGapPx, a.getY(), laneW, a.getHeight());
+
+        const float totalGapH = kSegGapPx * (float) (kSegN - 1);
+        const float rawSegH   = (laneL.getHeight() - totalGapH) / (float) kSegN;
+        segHPx = juce::jmax (kMinSegHPx, rawSegH);
+    }
+
+    // Lane area covered by the bottom litN segments (clip edge in the middle of the next gap).
+    juce::Rectangle<int> litSpan (juce::Rectangle<float> lane, int litN) const noexcept
+    {
+        if (litN <= 0)
+            return {};
+
+        const float top = lane.getBottom() - (float) litN * (segHPx + kSegGapPx) + 0.5f * kSegGapPx;
+        return juce::Rectangle<float> (lane.getX(), top, lane.getWidth(), lane.getBottom() - top)
+                   .getSmallestIntegerContainer();
+    }
+
+    void renderCaches (float scale)
+    {
+        const int w = getWidth();
+        const int h = getHeight();
+        cacheScale = scale;
+
+        if (w <= 0 || h <= 0)
+            return;
+
+        const int iw = juce::jmax (1, (int) std::ceil ((float) w * scale));
+        const int ih = juce::jmax (1, (int) std::ceil ((float) h * scale));
+
+        background = juce::Image (juce::Image::ARGB, iw, ih, true, juce::SoftwareImageType());
+        litStrip   = juce::Image (juce::Image::ARGB, iw, ih, true, juce::SoftwareImageType());
 
-        auto drawLane = [&] (juce::Rectangle<float> lane, int ch)
         {
+            juce::Graphics bg (background);
+            bg.addTransform (juce::AffineTransform::scale (scale));
 
-            //// [CML:UI] Stereo TP Meter Palette — Disciplined Ramp
-            constexpr float kDesatMix01 = 0.45f; // 0=full hue, 1=grey
+            drawFrameAndScale (bg);
+            drawSegments (bg, laneL, false);
+            drawSegments (bg, laneR, false);
+        }
 
-            constexpr float kGreyR  = 0.62f;
-            constexpr float kGreyG  = 0.62f;
-            constexpr float kGreyB  = 0.62f;
+        {
+            juce::Graphics lg (litStrip);
+            lg.addTransform (juce::AffineTransform::scale (scale));
 
-            constexpr float kGreenR = 0.30f;
-            constexpr float kGreenG = 0.68f;
-            constexpr float kGreenB = 0.46f;
+            drawSegments (lg, laneL, true);
+            drawSegments (lg, laneR, true);
+        }
+    }
 
-            constexpr float kYellR  = 0.95f;
-            constexpr float kYellG  = 0.86f;
-            constexpr float kYellB  = 0.40f;
+    void drawSegments (juce::Graphics& g, juce::Rectangle<float> lane, bool isActive) const
+    {
+        //// [CML:UI] Stereo TP Meter Palette — Disciplined Ramp
+        constexpr float kDesatMix01 = 0.45f; // 0=full hue, 1=grey
 
-            constexpr float kAmberR = 0.78f;
-            constexpr float kAmberG = 0.44f;
-            constexpr float kAmberB = 0.18f;
+        constexpr float kGreyR  = 0.62f;
+        constexpr float kGreyG  = 0.62f;
+        constexpr float kGreyB  = 0.62f;
 
-            const juce::Colour cGrey  = juce::Colour::fromFloatRGBA (kGreyR,  kGreyG,  kGreyB,  1.0f);
-            const juce::Colour cGreen = juce::Colour::fromFloatRGBA (kGreenR, kGreenG, kGreenB, 1.0f);
-            const juce::Colour cYell  = juce::Colour::fromFloatRGBA (kYellR,  kYellG,  kYellB,  1.0f);
-            const juce::Colour cAmber = juce::Colour::fromFloatRGBA (kAmberR, kAmberG, kAmberB, 1.0f);
+        constexpr float kGreenR = 0.30f;
+        constexpr float kGreenG = 0.68f;
+        constexpr float kGreenB = 0.46f;
 
-            const float totalGapH = kSegGapPx * (float) (kSegN - 1);
-            const float rawSegH   = (lane.getHeight() - totalGapH) / (float) kSegN;
-            const float segHPx    = juce::jmax (kMinSegHPx, rawSegH);
+        constexpr float kYellR  = 0.95f;
+        constexpr float kYellG  = 0.86f;
+        constexpr float kYellB  = 0.40f;
 
-            const float v01 = juce::jlimit (0.0f, 1.0f, (currentDb[ch] - kDbFloorDb) / kDbSpanDb);
-            const int litN = (int) (v01 * (float) kSegN + 0.5f);
-            for (int i = 0; i < kSegN; ++i)
-            {
-                const int idxFromBottom = i;
-                const float y = lane.getBottom() - (float) (idxFromBottom + 1) * segHPx - (float) idxFromBottom * kSegGapPx;
-                juce::Rectangle<float> seg (lane.getX(), y, lane.getWidth(), segHPx);
+        constexpr float kAmberR = 0.78f;
+        constexpr float kAmberG = 0.44f;
+        constexpr float kAmberB = 0.18f;
 
-                const bool isActive = (idxFromBottom < litN);
+        const juce::Colour cGrey  = juce::Colour::fromFloatRGBA (kGreyR,  kGreyG,  kGreyB,  1.0f);
+        const juce::Colour cGreen = juce::Colour::fromFloatRGBA (kGreenR, kGreenG, kGreenB, 1.0f);
+        const juce::Colour cYell  = juce::Colour::fromFloatRGBA (kYellR,  kYellG,  kYellB,  1.0f);
+        const juce::Colour cAmber = juce::Colour::fromFloatRGBA (kAmberR, kAmberG, kAmberB, 1.0f);
 
-                if (isActive)
-                {
-                    const float t = (kSegN > 1) ? ((float) idxFromBottom / (float) (kSegN - 1)) : 0.0f;
+        for (int i = 0; i < kSegN; ++i)
+        {
+            const int idxFromBottom = i;
+            const float y = lane.getBottom() - (float) (idxFromBottom + 1) * segHPx - (float) idxFromBottom * kSegGapPx;
+            juce::Rectangle<float> seg (lane.getX(), y, lane.getWidth(), segHPx);
 
-                    juce::Colour base;
-                    if (t < 0.50f)
-                        base = cGreen.interpolatedWith (cYell, t / 0.50f);
-                    else
-                        base = cYell.interpolatedWith (cAmber, (t - 0.50f) / 0.50f);
+            if (isActive)
+            {
+                const float t = (kSegN > 1) ? ((float) idxFromBottom / (float) (kSegN - 1)) : 0.0f;
 
-                    base = base.interpolatedWith (cGrey, kDesatMix01);
-                    g.setColour (base.withAlpha (kActiveAlpha01));
-                }
+                juce::Colour base;
+                if (t < 0.50f)
+                    base = cGreen.interpolatedWith (cYell, t / 0.50f);
                 else
-                {
-                    g.setColour (cGrey.withAlpha (kInactiveAlpha01));
-                }
+                    base = cYell.interpolatedWith (cAmber, (t - 0.50f) / 0.50f);
 
-                g.fillRoundedRectangle (seg, 1.5f);
+                base = base.interpolatedWith (cGrey, kDesatMix01);
+                g.setColour (base.withAlpha (kActiveAlpha01));
+            }
+            else
+            {
+                g.setColour (cGrey.withAlpha (kInactiveAlpha01));
             }
 
-            const float h01 = juce::jlimit (0.0f, 1.0f, (heldDb[ch] - kDbFloorDb) / kDbSpanDb);
-            const float yHold = lane.getBottom() - lane.getHeight() * h01;
-
-            g.setColour (juce::Colours::white);
-            g.drawLine (lane.getX(), yHold, lane.getRight(), yHold, 1.0f);
+            g.fillRoundedRectangle (seg, 1.5f);
+        }
+    }
 
-};
+    void drawFrameAndScale (juce::Graphics& g) const
+    {
+        auto r = getLocalBounds().toFloat();
 
-        drawLane (laneL, 0);
-        drawLane (laneR, 1);
+        g.setColour (juce::Colours::white.withAlpha (kBgStrokeAlpha01));
+        g.drawRoundedRectangle (r, kCornerPx, kBgStrokePx);
 
         if (drawScaleTicks)
         {
@@ -351,10 +661,13 @@ public:
         }
     }
 
-private:
-    static constexpr float kDbFloorDb = -120.0f;
-    static constexpr float kDbCeilDb  = 6.0f;
-    static constexpr float kDbSpanDb  = (kDbCeilDb - kDbFloorDb);
+    juce::Rectangle<float> laneL, laneR, scaleL, scaleR;
+    float segHPx         = kMinSegHPx;
+    bool  drawScaleTicks = false;
+    bool  drawScaleText  = false;
+
+    juce::Image background, litStrip; // rebuilt on resize / scale change
+    float cacheScale = 0.0f;
 
     float currentDb[2] = { kDbFloorDb, kDbFloorDb };
     float heldDb[2]    = { kDbFloorDb, kDbFloorDb };
@@ -365,7 +678,6 @@ class CompassKnobLookAndFeel;
 
 class CompassMasteringLimiterAudioProcessorEditor final
     : public juce::AudioProcessorEditor
-    , private juce::Timer
 {
 public:
     explicit CompassMasteringLimiterAudioProcessorEditor (CompassMasteringLimiterAudioProcessor&);
@@ -375,7 +687,13 @@ public:
     void resized() override;
 
 private:
-    void timerCallback() override;
+    // compass_ui_bench: headless rendering harness (defined in compass_ui_bench/Source/main.cpp only).
+    friend struct CompassUiBenchAccess;
+
+    void onVBlank();
+
+    void paintStaticLayer (juce::Graphics&);
+    juce::Rectangle<float> grTabArea() const noexcept;
 
     CompassMasteringLimiterAudioProcessor& processor;
 
@@ -387,6 +705,7 @@ private:
     juce::Slider bias;
     juce::TextButton stereoLink;
     juce::ComboBox oversamplingMin;
+    juce::ComboBox oversamplingOffline;
 
     GRHistoryMeter grMeter;
     juce::Label grTitleLabel;
@@ -400,8 +719,31 @@ private:
     juce::Label outTpLabel;
     juce::Label lufsSLabel;
     juce::Label lufsILabel;
+    juce::Label cpuLoadLabel;
     juce::Label biasValueLabel;
 
+    // Cached APVTS raw values for the top rotary readouts (as the processor's ParamPtrs).
+    struct ReadoutParams final
+    {
+        std::atomic<float>* trim    = nullptr;
+        std::atomic<float>* drive   = nullptr;
+        std::atomic<float>* ceiling = nullptr;
+    };
+    ReadoutParams readoutParams;
+
+    // Drain target for the meter timer (one point per snapshot published since the previous tick).
+    std::array<CompassMasteringLimiterAudioProcessor::MeterHistoryPoint,
+               (size_t) CompassMasteringLimiterAudioProcessor::kMeterRingCapacity> meterDrainPoints {};
+
+    // Values currently on screen, in 0.1 steps (change detection: unchanged readouts are not re-set/repainted).
+    enum ShownReadout { kShownGr, kShownTrim, kShownGlue, kShownCeiling,
+                        kShownInL, kShownInR, kShownOutL, kShownOutR, kShownLufsS, kShownLufsI, kNumShown };
+    std::array<int, kNumShown> shownTenths = [] { std::array<int, kNumShown> a {}; a.fill (std::numeric_limits<int>::min()); return a; }();
+    std::array<int, 6> shownCpu { -1, -1, -1, -1, -1, -1 };
+
+    juce::Image staticLayer; // background, well, tab body, static labels; rebuilt on resize / scale change
+    float staticLayerScale = 0.0f;
+
     juce::Label trimValueLabel;
     juce::Label glueValueLabel;
     juce::Label ceilingValueLabel;
@@ -418,6 +760,9 @@ private:
     std::unique_ptr<APVTS::SliderAttachment> biasA;
     std::unique_ptr<APVTS::ButtonAttachment> linkA;
     std::unique_ptr<APVTS::ComboBoxAttachment> osA;
+    std::unique_ptr<APVTS::ComboBoxAttachment> osOfflineA;
+
+    juce::VBlankAttachment vblank; // last: detached before anything it calls into is destroyed
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (CompassMasteringLimiterAudioProcessorEditor)
 };
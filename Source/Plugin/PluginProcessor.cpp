@@ -1,5 +1,6 @@
 #include "PluginProcessor.h"
 #include "PluginEditor.h"
+#include "StageProfiler.h"
 
 CompassMasteringLimiterAudioProcessor::CompassMasteringLimiterAudioProcessor()
 : juce::AudioProcessor (BusesProperties()
@@ -12,6 +13,18 @@ CompassMasteringLimiterAudioProcessor::CompassMasteringLimiterAudioProcessor()
 )
 {
     apvts = std::make_unique<APVTS>(*this, nullptr, "PARAMS", createParameterLayout());
+
+    params.drive               = apvts->getRawParameterValue ("drive");
+    params.ceiling             = apvts->getRawParameterValue ("ceiling");
+    params.adaptiveBias        = apvts->getRawParameterValue ("adaptive_bias");
+    params.stereoLink          = apvts->getRawParameterValue ("stereo_link");
+    params.oversamplingMin     = apvts->getRawParameterValue ("oversampling_min");
+    params.oversamplingOffline = apvts->getRawParameterValue ("oversampling_offline");
+    params.trim                = apvts->getRawParameterValue ("trim");
+    params.bypass              = apvts->getRawParameterValue ("bypass");
+    jassert (params.drive != nullptr && params.ceiling != nullptr && params.adaptiveBias != nullptr
+             && params.stereoLink != nullptr && params.oversamplingMin != nullptr
+             && params.oversamplingOffline != nullptr && params.trim != nullptr && params.bypass != nullptr);
 }
 
 CompassMasteringLimiterAudioProcessor::APVTS::ParameterLayout
@@ -110,6 +123,21 @@ layout.add(std::make_unique<juce::AudioParameterFloat>(
         0
     ));
 
+    // Offline quality tier: applies only while the host renders nonrealtime ("Same" = follow oversampling_min).
+    layout.add (std::make_unique<juce::AudioParameterChoice>(
+        juce::ParameterID { "oversampling_offline", 1 },
+        "Oversampling Offline",
+        juce::StringArray { "Same", "16x", "32x" },
+        0
+    ));
+
+    // Host bypass (returned by getBypassParameter): ramped + latency-matched in processBlock, engine suspended when dry.
+    layout.add (std::make_unique<juce::AudioParameterBool>(
+        juce::ParameterID { "bypass", 1 },
+        "Bypass",
+        false
+    ));
+
     return layout;
 }
 
@@ -120,27 +148,20 @@ void CompassMasteringLimiterAudioProcessor::reset (double sampleRate, int maxBlo
     effectiveControlInvDt = lastInvSampleRate;
     effectiveAudioInvDt   = lastInvSampleRate; // OSFactor=1.0 until oversampled audio-path processing is introduced
     lastMaxBlock   = (maxBlock > 0 ? maxBlock : 0);
+    housekeepingCountdown = 0; // first block after a reset runs the full prologue
     lastChannels   = (channels > 0 ? channels : 0);
 
     // Phase 11 — Metering Plumbing: deterministic meter timing + accumulator reset (single source of truth).
     meterDt = 1.0 / lastSampleRate;
-    meterPublishSamples = (int) juce::jmax (1.0, lastSampleRate / 50.0); // 50 Hz, clamped
+    meterPublishSamples = (int) juce::jmax (1.0, lastSampleRate / (double) meterRateHzApplied);
+    lufsChunkSamples    = (int) juce::jmax (1.0, lastSampleRate / (double) kLufsHz);
     lastLink01Smoothed = 1.0;
     meterCountdown = meterPublishSamples;
 
-    for (int c = 0; c < 2; ++c)
-    {
-        inPeakHold[c]  = 0.0;
-        outPeakHold[c] = 0.0;
-        inRmsSq[c]     = 0.0;
-        outRmsSq[c]    = 0.0;
-        inTpHold[c]    = 0.0;
-        outTpHold[c]   = 0.0;
-        grHoldDb[c]    = 0.0;
-    }
+    clearMeterHolds();
 
-    // Loudness reset (deterministic; bounded; allocation-free).
-    lufsChunkE.fill (0.0);
+    // Loudness reset (deterministic; bounded; allocation-free). lufsChunkE is not cleared: slots are only
+    // read once lufsChunkFilled has wrapped, i.e. after they were rewritten.
     lufsChunkWrite  = 0u;
     lufsChunkFilled = 0u;
     lufsShortSumE   = 0.0;
@@ -149,17 +170,14 @@ void CompassMasteringLimiterAudioProcessor::reset (double sampleRate, int maxBlo
     lufsIntSumE     = 0.0;
     lufsIntN        = 0u;
 
-    // Publication bookkeeping reset (deterministic; lock-free). Do NOT clear meterRing here (reset() may run on audio thread).
-    meterWriteIndex.store (0u, std::memory_order_relaxed);
-    meterReadIndex.store  (0u, std::memory_order_relaxed);
-    meterSeq.store        (0u, std::memory_order_relaxed);
-    meterLastReadSeq.store(0u, std::memory_order_relaxed);
+    // Publication counters are not touched here (reset() may run on the audio thread while a consumer reads);
+    // the ring is cleared only in prepareToPlay / releaseResources.
 
     // Deterministic reset of adaptive/envelope/guard state:
-    const float driveDb   = apvts->getRawParameterValue ("drive")->load();
-    const float ceilingDb = apvts->getRawParameterValue ("ceiling")->load();
-    const float bias01    = apvts->getRawParameterValue ("adaptive_bias")->load();
-    const float link01    = apvts->getRawParameterValue ("stereo_link")->load();
+    const float driveDb   = params.drive->load();
+    const float ceilingDb = params.ceiling->load();
+    const float bias01    = params.adaptiveBias->load();
+    const float link01    = params.stereoLink->load();
 
     driveDbSmoothed.reset (lastSampleRate, 0.020);        // 20 ms
     ceilingDbSmoothed.reset (lastSampleRate, 0.020);      // 20 ms
@@ -171,6 +189,11 @@ void CompassMasteringLimiterAudioProcessor::reset (double sampleRate, int maxBlo
     adaptiveBias01Smoothed.setCurrentAndTargetValue (bias01);
     stereoLink01Smoothed.setCurrentAndTargetValue (link01);
 
+    trimDbCached  = params.trim->load();
+    trimLinCached = std::pow (10.0f, trimDbCached / 20.0f);
+    trimLinSmoothed.reset (lastSampleRate, 0.020);          // 20 ms
+    trimLinSmoothed.setCurrentAndTargetValue (trimLinCached);
+
     // Envelope state reset (deterministic; bounded)
     microStage1DbState = { 0.0, 0.0 };
     microStage2DbState = { 0.0, 0.0 };
@@ -179,6 +202,38 @@ void CompassMasteringLimiterAudioProcessor::reset (double sampleRate, int maxBlo
     lastAttnTargetDb   = { 0.0, 0.0 };
     lastAppliedAttnDb  = { 0.0, 0.0 };
 
+    // Spectral Guardrails coefficients: the measurement runs at the native rate in every tier (measureNativeSample).
+    {
+        const double fs = juce::jmax (1.0, lastSampleRate);
+
+        // Phase 1.7 Priority 4: guardrail HPF cutoff fs/5.5, 2nd-order Butterworth
+        const double kGuardFcHz = fs / 5.5;
+        const double w0 = 2.0 * juce::MathConstants<double>::pi * kGuardFcHz / fs;
+        const double cw = std::cos (w0);
+        const double sw = std::sin (w0);
+        constexpr double Q = 0.7071067811865476;
+        const double alpha = sw / (2.0 * Q);
+        const double a0 = (1.0 + alpha);
+        guardNb0 = ((1.0 + cw) * 0.5) / a0;
+        guardNb1 = (-(1.0 + cw)) / a0;
+        guardNb2 = ((1.0 + cw) * 0.5) / a0;
+        guardNa1 = (-(2.0 * cw)) / a0;
+        guardNa2 = (1.0 - alpha) / a0;
+
+        // Phase 1.7 Priority 4: 1st-order low-shelf post-compensation (+3 dB @ 200 Hz), bilinear prewarp
+        const double gainDb = 3.0;
+        const double fc = 200.0;
+        const double omega = 2.0 * fs * std::tan (juce::MathConstants<double>::pi * fc / fs);
+        const double A = std::pow (10.0, gainDb / 40.0);
+        lowShelfB0 = (1.0 + A * omega) / (1.0 + omega);
+        lowShelfB1 = (A * omega - 1.0) / (1.0 + omega);
+        lowShelfA1 = (omega - 1.0) / (1.0 + omega);
+
+        // HF smoothing (5 ms) and energy integrator (20 ms) at the native step
+        guardHfAlpha  = std::exp (-lastInvSampleRate / 0.005);
+        guardAccAlpha = std::exp (-lastInvSampleRate / 0.020);
+    }
+
     // Spectral Guardrails state (measurement-only)
     guardLpState = { 0.0, 0.0 };
     guardHpState2 = { 0.0, 0.0 };
@@ -200,18 +255,13 @@ void CompassMasteringLimiterAudioProcessor::reset (double sampleRate, int maxBlo
     jassert (rmsWinN <= kCrestRmsWinMaxN);
    #endif
 
-    for (int c = 0; c < 2; ++c)
-    {
-        rmsSqSum[c] = 0.0;
-        rmsWriteIdx[c] = 0;
-        rmsSilenceCount[c] = 0;
-        for (int i = 0; i < kCrestRmsWinMaxN; ++i)
-            rmsSqRing[c][i] = 0.0;
-    }
+    resetCrestRmsWindows();
+    crestRmsDb = { -240.0, -240.0 };
 
     eventDensityState  = { 0.0, 0.0 };
 
     lastOutScalar = { 1.0f, 1.0f };
+    lastCeilScalar = { 1.0f, 1.0f };
 
     // Ceiling envelope (state + coeffs) — computed here (SR-dependent), never in processBlock.
     for (int c = 0; c < 2; ++c)
@@ -249,14 +299,109 @@ void CompassMasteringLimiterAudioProcessor::reset (double sampleRate, int maxBlo
     }
 }
 
+void CompassMasteringLimiterAudioProcessor::resetAtTransportBoundary() noexcept
+{
+    // Audio thread: every reset here is O(1) or bounded by small fixed state (lazy RMS/LUFS windows).
+    const int ch = juce::jmax (getTotalNumInputChannels(), getTotalNumOutputChannels());
+    reset (lastSampleRate, lastMaxBlock, ch);
+
+    ceilingGainState[0] = 1.0f;
+    ceilingGainState[1] = 1.0f;
+    ceilingGainStateLinked = 1.0f;
+
+    // Transport-safe boundary: latch oversampling selection (no allocations here).
+    const int osMinIndexBoundary = (int) params.oversamplingMin->load();
+    selectOversamplingAtBoundary (osMinIndexBoundary);
+}
+
+bool CompassMasteringLimiterAudioProcessor::linkedChainsIdentical (double s0, double s1) const noexcept
+{
+    // Everything the per-channel envelope chain reads: detector sample, TP derivative, crest RMS, and its state.
+    return s0 == s1
+        && tpDerivLin[0]          == tpDerivLin[1]
+        && crestRmsDb[0]          == crestRmsDb[1]
+        && silenceCountSamples[0] == silenceCountSamples[1]
+        && lastAttnTargetDb[0]    == lastAttnTargetDb[1]
+        && macroEnergyState[0]    == macroEnergyState[1]
+        && eventDensityState[0]   == eventDensityState[1]
+        && microStage1DbState[0]  == microStage1DbState[1]
+        && microStage2DbState[0]  == microStage2DbState[1];
+}
+
+void CompassMasteringLimiterAudioProcessor::prepareParamRamps (int n) noexcept
+{
+    jassert (n <= kOsTileSamples);
+
+    paramsRamping = driveDbSmoothed.isSmoothing() || ceilingDbSmoothed.isSmoothing()
+                 || adaptiveBias01Smoothed.isSmoothing() || stereoLink01Smoothed.isSmoothing();
+
+    if (! paramsRamping)
+    {
+        paramSteady.driveDb   = (double) driveDbSmoothed.getTargetValue();
+        paramSteady.ceilingDb = (double) ceilingDbSmoothed.getTargetValue();
+        paramSteady.bias01    = juce::jlimit (0.0, 1.0, (double) adaptiveBias01Smoothed.getTargetValue());
+        paramSteady.link01    = juce::jlimit (0.0, 1.0, (double) stereoLink01Smoothed.getTargetValue());
+        return;
+    }
+
+    auto fillRamp = [n] (auto& smoother, std::array<float, (size_t) kOsTileSamples>& dst) noexcept
+    {
+        if (smoother.isSmoothing())
+        {
+            for (int i = 0; i < n; ++i)
+                dst[(size_t) i] = smoother.getNextValue();
+        }
+        else
+        {
+            juce::FloatVectorOperations::fill (dst.data(), smoother.getTargetValue(), n);
+        }
+    };
+
+    fillRamp (driveDbSmoothed,        rampDriveDb);
+    fillRamp (ceilingDbSmoothed,      rampCeilingDb);
+    fillRamp (adaptiveBias01Smoothed, rampBias01);
+    fillRamp (stereoLink01Smoothed,   rampLink01);
+}
+
+template <typename SampleType>
+void CompassMasteringLimiterAudioProcessor::applyTrim (juce::AudioBuffer<SampleType>& buffer) noexcept
+{
+    trimLinSmoothed.setTargetValue (trimLinCached);
+
+    const int numCh = buffer.getNumChannels();
+    const int n     = buffer.getNumSamples();
+
+    // Ramp one kOsTileSamples span at a time while smoothing; the steady remainder is a single applyGain.
+    int r0 = 0;
+    while (r0 < n && trimLinSmoothed.isSmoothing())
+    {
+        const int nR = juce::jmin (kOsTileSamples, n - r0);
+        for (int i = 0; i < nR; ++i)
+            rampTrimLin[(size_t) i] = trimLinSmoothed.getNextValue();
+
+        for (int c = 0; c < numCh; ++c)
+        {
+            SampleType* d = buffer.getWritePointer (c) + r0;
+            for (int i = 0; i < nR; ++i)
+                d[i] *= (SampleType) rampTrimLin[(size_t) i];
+        }
+
+        r0 += nR;
+    }
+
+    if (r0 < n)
+        buffer.applyGain (r0, n - r0, (SampleType) trimLinCached);
+}
+
 void CompassMasteringLimiterAudioProcessor::prepareToPlay (double sampleRate, int samplesPerBlock)
 {
     const int ch = juce::jmax (getTotalNumInputChannels(), getTotalNumOutputChannels());
     reset (sampleRate, samplesPerBlock, ch);
 
-    // Optional deterministic ring init (fixed-size, outside audio thread).
+    // Deterministic ring init (fixed-size, outside audio thread).
     // This is allowed here (prepareToPlay is not the audio callback boundary).
-    meterRing.fill (MeterSnapshot {});
+    meterRing.reset();
+    meterFrameCounter = 0u;
 
     // Phase 1.x — Hot-path exp/log tables (deterministic; fixed-size; no audio-thread init)
     {
@@ -279,13 +424,24 @@ void CompassMasteringLimiterAudioProcessor::prepareToPlay (double sampleRate, in
     // Prebuild oversampling instances (no allocations in audio thread).
     prepareOversampling (ch, samplesPerBlock);
 
+    // Offline 16x/32x tier: built only when preparing for a nonrealtime render (realtime keeps the memory free).
+    if (isNonRealtime())
+        prepareOfflineOversampling (ch, samplesPerBlock);
+    else
+        releaseOfflineOversampling();
+
     // Latch initial oversampling selection (treated as transport-safe init).
-    const int osMinIndex = (int) apvts->getRawParameterValue ("oversampling_min")->load();
+    const int osMinIndex = (int) params.oversamplingMin->load();
     selectOversamplingAtBoundary (osMinIndex);
 
     // Transport becomes unknown on prepare (hosts differ); edge detection begins on first block.
     transportKnown = false;
     lastTransportPlaying = false;
+
+    resetCpuLoadTelemetry();
+    resetOverloadScheduler();
+
+    flightRecorder.prepare (sampleRate);
 }
 
 void CompassMasteringLimiterAudioProcessor::releaseResources()
@@ -293,25 +449,32 @@ void CompassMasteringLimiterAudioProcessor::releaseResources()
 
     // Phase 11 — Metering Plumbing: deterministic teardown reset (no SR math here).
     meterPublishSamples = 0;
+    lufsChunkSamples    = 0;
     meterCountdown      = 0;
     meterDt             = 0.0;
 
-    for (int c = 0; c < 2; ++c)
+    clearMeterHolds();
+
+    meterRing.reset();
+    meterFrameCounter = 0u;
+
+    releaseOfflineOversampling();
+
+    flightRecorder.release();
+}
+
+void CompassMasteringLimiterAudioProcessor::setNonRealtime (bool isNonRealtimeNow) noexcept
+{
+    // Message thread: hosts may switch to offline rendering without a fresh prepareToPlay.
+    // Build the offline tier here (never on the audio thread) and publish offlineOversamplersReady
+    // before the flag flips: processBlock latches at the first nonrealtime block and the edge is not repeated.
+    if (isNonRealtimeNow && lastMaxBlock > 0 && ! offlineOversamplersReady.load (std::memory_order_acquire))
     {
-        inPeakHold[c]  = 0.0;
-        outPeakHold[c] = 0.0;
-        inRmsSq[c]     = 0.0;
-        outRmsSq[c]    = 0.0;
-        inTpHold[c]    = 0.0;
-        outTpHold[c]   = 0.0;
-        grHoldDb[c]    = 0.0;
+        const int ch = juce::jmax (getTotalNumInputChannels(), getTotalNumOutputChannels());
+        prepareOfflineOversampling (ch, lastMaxBlock);
     }
 
-    meterWriteIndex.store (0u, std::memory_order_relaxed);
-    meterReadIndex.store  (0u, std::memory_order_relaxed);
-    meterSeq.store        (0u, std::memory_order_relaxed);
-    meterLastReadSeq.store(0u, std::memory_order_relaxed);
-
+    AudioProcessor::setNonRealtime (isNonRealtimeNow);
 }
 
 bool CompassMasteringLimiterAudioProcessor::isBusesLayoutSupported (const BusesLayout& layouts) const
@@ -499,58 +662,34 @@ bool CompassMasteringLimiterAudioProcessor::probeContinuityFastAutomation (doubl
     return (maxAbsDelta <= 0.01);
 }
 
-void CompassMasteringLimiterAudioProcessor::processOneSample (float* const* chPtr,
-                                                             int numCh,
-                                                             int i,
-                                                             double dt,
-                                                             double driveDb,
-                                                             double ceilingDb,
-                                                             double bias01,
-                                                             double link01,
-                                                             double& grDbNegMin) noexcept
+template <typename SampleType>
+void CompassMasteringLimiterAudioProcessor::measureNativeSample (const SampleType* const* chPtr, int numCh, int i) noexcept
 {
-    // Softplus controls (smooth, monotonic, branch-free)
-    constexpr double kEpsLin    = 1.0e-12; // avoids log(0)
-    constexpr double kSoftK     = 32.0;
-    constexpr double kMaxAttnDb = 120.0;
-
-    // Time constants (seconds). Names avoid forbidden terminology.
-    constexpr double kMacroSecBase = 0.1200; // 120 ms nominal
-
-    std::array<double, 2> attnDbCh { 0.0, 0.0 };
-
-    // Spectral Guardrails (Phase 1.7): parallel HF measurement only (no influence on envelope)
-    // Pipeline (per channel):
-    // - 2nd-order Butterworth HPF @ 8 kHz on abs(s)
-    // - One-pole smoothing tau = 5 ms
-    // - Leaky integrator on squared smoothed output tau = 20 ms
-    constexpr double kGuardFcHz = 8000.0;
-    constexpr double kHfTauSec  = 0.005;
-    constexpr double kAccTauSec = 0.020;
-
     const int chProc = juce::jmin (2, numCh);
-    double hfEnergyStereo = 0.0;
 
-    const bool overloadAssistOn = (overloadAssistBlocks > 0);
+    // Overload level >= 1: HF measurement held (the guardrail keeps acting on the last measured energy).
+    const bool holdHf = (overloadLevel >= 1);
 
     for (int c = 0; c < chProc; ++c)
     {
         const double s = (double) chPtr[c][i];
+        const double absS = std::abs (s);
 
-        // Step 4 — Compute Input peak + RMS (broadband), linear domain (no dB).
-        // Guard: accumulators are 2ch; never index beyond [0..1].
-        if (c < 2)
+        // Step 4 — Compute Input peak + RMS (broadband), linear domain (no dB). Consumer-gated.
+        if (metersActive)
         {
-            const double inAbs = std::abs (s);
-            inPeakHold[(size_t) c] = juce::jmax (inPeakHold[(size_t) c], inAbs);
-            inRmsSq[(size_t) c] += (inAbs * inAbs);
+            inPeakHold[(size_t) c] = juce::jmax (inPeakHold[(size_t) c], absS);
+            inRmsSq[(size_t) c] += (absS * absS);
         }
 
-        if (! overloadAssistOn)
+        // Spectral Guardrails (Phase 1.7): parallel HF measurement only (no influence on envelope)
+        // - 2nd-order Butterworth HPF @ fs/5.5 (~8 kHz at 44.1 kHz) on abs(s)
+        // - One-pole smoothing tau = 5 ms
+        // - Leaky integrator on squared smoothed output tau = 20 ms
+        if (! holdHf)
         {
             double z1 = guardLpState[(size_t) c];
             double z2 = guardHpState2[(size_t) c];
-            const double absS = std::abs (s);
             double y = guardNb0 * absS + z1;
             z1 = guardNb1 * absS - guardNa1 * y + z2;
             z2 = guardNb2 * absS - guardNa2 * y;
@@ -562,19 +701,127 @@ void CompassMasteringLimiterAudioProcessor::processOneSample (float* const* chPt
             lowShelfZ1[(size_t) c] = lowShelfB1 * y - lowShelfA1 * yShelf;
             y = yShelf;
 
-            const double aHf  = expLookup (dt / kHfTauSec);
-            const double aAcc = expLookup (dt / kAccTauSec);
-
             // hfSmoothed (tau = 5 ms) stored in guardTotE
-            const double hfSm = aHf * guardTotE[(size_t) c] + (1.0 - aHf) * y;
+            const double hfSm = guardHfAlpha * guardTotE[(size_t) c] + (1.0 - guardHfAlpha) * y;
             guardTotE[(size_t) c] = hfSm;
 
             // hfEnergy (tau = 20 ms) stored in guardHiE
-            const double e = aAcc * guardHiE[(size_t) c] + (1.0 - aAcc) * (hfSm * hfSm);
-            guardHiE[(size_t) c] = e;
-
-            if (e > hfEnergyStereo) hfEnergyStereo = e;
+            guardHiE[(size_t) c] = guardAccAlpha * guardHiE[(size_t) c] + (1.0 - guardAccAlpha) * (hfSm * hfSm);
         }
+    }
+
+    // Phase 1.4 — Crest Factor RMS Window (50 ms rectangular MA over native samples).
+    // Deterministic silence reset (100 ms): counter increments while the sample is below -90 dB.
+    constexpr double kSilenceLin = 3.1622776601683795e-5; // -90 dBFS
+    constexpr double eps = 1.0e-12;
+
+    auto pushCrestRms = [this] (int c, double absS) noexcept
+    {
+        if (absS < kSilenceLin)
+            ++rmsSilenceCount[(size_t) c];
+        else
+            rmsSilenceCount[(size_t) c] = 0;
+
+        if (rmsSilenceCount[(size_t) c] >= rmsSilenceResetN)
+            resetCrestRmsWindows();
+
+        const double newSq = absS * absS;
+        const int idx = rmsWriteIdx[(size_t) c];
+
+        // Slots not yet written since the last reset are stale and count as 0 (lazy reset).
+        double oldSq = 0.0;
+        if (rmsFilled[(size_t) c] >= rmsWinN)
+            oldSq = rmsSqRing[(size_t) c][idx];
+        else
+            ++rmsFilled[(size_t) c];
+
+        rmsSqRing[(size_t) c][idx] = newSq;
+        rmsSqSum[(size_t) c] += (newSq - oldSq);
+
+        int nextIdx = idx + 1;
+        if (nextIdx >= rmsWinN) nextIdx = 0;
+        rmsWriteIdx[(size_t) c] = nextIdx;
+
+        rmsSqSum[(size_t) c] = juce::jmax (0.0, rmsSqSum[(size_t) c]);
+    };
+
+    for (int c = 0; c < chProc; ++c)
+        pushCrestRms (c, std::abs ((double) chPtr[c][i]));
+
+    for (int c = 0; c < chProc; ++c)
+        crestRmsDb[(size_t) c] = 20.0 * std::log10 (std::sqrt (rmsSqSum[(size_t) c] / (double) rmsWinN) + eps);
+}
+
+template <typename SampleType>
+void CompassMasteringLimiterAudioProcessor::measureNativeOutputSample (const SampleType* const* chPtr, int numCh, int i) noexcept
+{
+    // Step 4 — Compute Output peak + RMS (broadband), linear domain (no dB). Consumer-gated.
+    // Guard: accumulators are 2ch; never index beyond [0..1].
+    const int chProcOut = (metersActive ? juce::jmin (2, numCh) : 0);
+    for (int c = 0; c < chProcOut; ++c)
+    {
+        const double outAbs = std::abs ((double) chPtr[c][i]);
+        outPeakHold[(size_t) c] = juce::jmax (outPeakHold[(size_t) c], outAbs);
+        outRmsSq[(size_t) c] += (outAbs * outAbs);
+    }
+}
+
+template <typename SampleType>
+void CompassMasteringLimiterAudioProcessor::processOneSample (SampleType* const* chPtr,
+                                                             int numCh,
+                                                             int i,
+                                                             double dt,
+                                                             double driveDb,
+                                                             double ceilingDb,
+                                                             double bias01,
+                                                             double link01,
+                                                             double& grDbNegMin) noexcept
+{
+    // Softplus controls (smooth, monotonic, branch-free)
+    constexpr double kEpsLin    = 1.0e-12; // avoids log(0)
+    constexpr double kSoftK     = 32.0;
+    constexpr double kMaxAttnDb = 120.0;
+
+    // Time constants (seconds). Names avoid forbidden terminology.
+    constexpr double kMacroSecBase = 0.1200; // 120 ms nominal
+
+    std::array<double, 2> attnDbCh { 0.0, 0.0 };
+
+    const int chProc = juce::jmin (2, numCh);
+
+    // Overload level >= 1: HF measurement held (flight recorder flag; see measureNativeSample).
+    const bool overloadAssistOn = (overloadLevel >= 1);
+
+    constexpr double kLinkSmoothingTauSec = 0.007;
+    const double aLink = onePoleAlpha (kLinkSmoothingTauSec, dt);
+    lastLink01Smoothed = aLink * lastLink01Smoothed + (1.0 - aLink) * link01;
+    const double link01Smooth = juce::jlimit (0.0, 1.0, lastLink01Smoothed);
+
+    // Linked fast path: with the link settled at 1 and both chains about to compute the same thing (same input,
+    // same state), one envelope chain runs in slot 0 and is mirrored into slot 1. Bit-identical to the two-chain
+    // path by construction; decorrelated stereo fails the check on the first comparison and runs both chains.
+    const bool linkedFast = linkedFastPathEnabled && (chProc == 2) && (link01Smooth >= kLinkedFastPathMinLink)
+                         && linkedChainsIdentical ((double) chPtr[0][i], (double) chPtr[1][i]);
+
+    COMPASS_STAGE_LAP_BEGIN (stageLap, stageCounters);
+
+    // Measurement-only state (input meters, HF guardrail energy, crest RMS) is advanced once per native
+    // sample by measureNativeSample(); here it is only read.
+    double hfEnergyStereo = 0.0;
+
+    for (int c = 0; c < chProc; ++c)
+    {
+        hfEnergyStereo = juce::jmax (hfEnergyStereo, guardHiE[(size_t) c]);
+    }
+
+    COMPASS_STAGE_LAP_SPLIT (stageLap, Guardrail);
+
+    const int chains = (linkedFast ? 1 : chProc);
+
+    for (int c = 0; c < chains; ++c)
+    {
+        const double s = (double) chPtr[c][i];
+        const double derivLin = tpDerivLin[(size_t) c];
 
         const double tpDb = 20.0 * std::log10 (std::abs (s) + kEpsLin);
 
@@ -598,11 +845,15 @@ void CompassMasteringLimiterAudioProcessor::processOneSample (float* const* chPt
                 macroEnergyState[(size_t) c]   = 0.0;
                 eventDensityState[(size_t) c]  = 0.0;
 
-                guardLpState[(size_t) c]       = 0.0;
-                guardHpState2[(size_t) c] = 0.0;
-                guardTotE[(size_t) c]          = 0.0;
-                guardHiE[(size_t) c]           = 0.0;
-                lowShelfZ1[(size_t) c]         = 0.0;
+                // Slot 1 would reset on the same sample (identical state): clear its measurement slots too.
+                for (int g = c; g <= (linkedFast ? 1 : c); ++g)
+                {
+                    guardLpState[(size_t) g]  = 0.0;
+                    guardHpState2[(size_t) g] = 0.0;
+                    guardTotE[(size_t) g]     = 0.0;
+                    guardHiE[(size_t) g]      = 0.0;
+                    lowShelfZ1[(size_t) g]    = 0.0;
+                }
 
                 silenceCountSamples[(size_t) c] = 0;
             }
@@ -615,6 +866,10 @@ void CompassMasteringLimiterAudioProcessor::processOneSample (float* const* chPt
         double attnTargetDb = softplus / kSoftK;
         attnTargetDb = juce::jlimit (0.0, kMaxAttnDb, attnTargetDb);
 
+        flightProbe.detectorDb[(size_t) c] = (float) tpDb;
+
+        COMPASS_STAGE_LAP_SPLIT (stageLap, Detector);
+
         // Priority 7 — Adaptive GR floor & hysteresis (pre-gate proxy macro01; bounded ±0.03 dB)
         constexpr double kGrFloorDbBase    = 0.05;
         constexpr double kHysteresisDbBase = 0.08;
@@ -657,6 +912,9 @@ void CompassMasteringLimiterAudioProcessor::processOneSample (float* const* chPt
 
         lastAttnTargetDb[(size_t) c] = currentTarget;
         attnTargetDb = currentTarget;
+        flightProbe.attnTargetDb[(size_t) c] = (float) attnTargetDb;
+
+        COMPASS_STAGE_LAP_SPLIT (stageLap, Hysteresis);
 
         const double energyInput = juce::jmax (0.0, std::pow (10.0, attnTargetDb / 20.0) - 1.0);
 
@@ -676,45 +934,9 @@ void CompassMasteringLimiterAudioProcessor::processOneSample (float* const* chPt
         const double macro01 = macroEnergyState[(size_t) c] / (1.0 + macroEnergyState[(size_t) c]);
         const double sustained01 = juce::jlimit (0.0, 1.0, macro01);
 
-        // Phase 1.4 — Crest Factor RMS Window (50 ms rectangular MA) + Crest statistic binding
-        const double absS = std::abs (s);
-
-        // Deterministic silence reset (100 ms): counter increments when tpDb < -90 dB.
-        if (tpDb < -90.0)
-            ++rmsSilenceCount[(size_t) c];
-        else
-            rmsSilenceCount[(size_t) c] = 0;
-
-        if (rmsSilenceCount[(size_t) c] >= rmsSilenceResetN)
-        {
-            for (int cc = 0; cc < 2; ++cc)
-            {
-                rmsSqSum[cc] = 0.0;
-                rmsWriteIdx[cc] = 0;
-                rmsSilenceCount[cc] = 0;
-                for (int i = 0; i < kCrestRmsWinMaxN; ++i)
-                    rmsSqRing[cc][i] = 0.0;
-            }
-        }
-
-        const double newSq = absS * absS;
-        const int idx = rmsWriteIdx[(size_t) c];
-        const double oldSq = rmsSqRing[(size_t) c][idx];
-
-        rmsSqRing[(size_t) c][idx] = newSq;
-        rmsSqSum[(size_t) c] += (newSq - oldSq);
-
-        int nextIdx = idx + 1;
-        if (nextIdx >= rmsWinN) nextIdx = 0;
-        rmsWriteIdx[(size_t) c] = nextIdx;
-
-        rmsSqSum[(size_t) c] = juce::jmax (0.0, rmsSqSum[(size_t) c]);
-
-        const double rmsLin = std::sqrt (rmsSqSum[(size_t) c] / (double) rmsWinN);
-
-        constexpr double eps = 1.0e-12;
-        const double rmsDb = 20.0 * std::log10 (rmsLin + eps);
-        const double crestDb = tpDb - rmsDb;
+        // Phase 1.4 — Crest statistic: detector level against the native-rate 50 ms RMS window
+        // (measureNativeSample advances rmsWinN native samples, so the window is 50 ms in every tier).
+        const double crestDb = tpDb - crestRmsDb[(size_t) c];
 
         const double w_cf = juce::jlimit (0.0, 1.0, (crestDb - 6.0) / 18.0);
 
@@ -792,7 +1014,7 @@ void CompassMasteringLimiterAudioProcessor::processOneSample (float* const* chPt
         constexpr double maxReleaseDbPerSec = 1800.0;    // 10× slower = musical recovery, no pumping
 
         // Convert to per-sample limits using the actual time step (dt)
-        const double derivNorm = juce::jlimit (0.0, 1.0, tpDerivLin[(size_t) c] / 0.5);
+        const double derivNorm = juce::jlimit (0.0, 1.0, derivLin / 0.5);
         const double attackBoost = 1.0 + 0.2 * derivNorm;
 
         const double attackScale = 0.85 + 0.30 * w_cf;
@@ -814,14 +1036,34 @@ void CompassMasteringLimiterAudioProcessor::processOneSample (float* const* chPt
         microStage2DbState[(size_t) c] = x2;
 
         attnDbCh[(size_t) c] = x1;
+
+        flightProbe.microDb[(size_t) c]          = (float) x1;
+        flightProbe.microVelDbPerSec[(size_t) c] = (float) x2;
+        flightProbe.macroEnergy[(size_t) c]      = (float) Enext;
+
+        COMPASS_STAGE_LAP_SPLIT (stageLap, Envelope);
     }
 
-    // Note: detector/envelope is 2ch; additional channels are not part of the attenuation-link computation.
+    if (linkedFast)
+    {
+        // Slot 1 takes the values its own chain would have computed, so the next sample may run either path.
+        microStage1DbState[1] = microStage1DbState[0];
+        microStage2DbState[1] = microStage2DbState[0];
+        macroEnergyState[1]   = macroEnergyState[0];
+        eventDensityState[1]  = eventDensityState[0];
+        lastAttnTargetDb[1]   = lastAttnTargetDb[0];
+        silenceCountSamples[1] = silenceCountSamples[0];
+
+        attnDbCh[1] = attnDbCh[0];
+
+        flightProbe.detectorDb[1]       = flightProbe.detectorDb[0];
+        flightProbe.attnTargetDb[1]     = flightProbe.attnTargetDb[0];
+        flightProbe.microDb[1]          = flightProbe.microDb[0];
+        flightProbe.microVelDbPerSec[1] = flightProbe.microVelDbPerSec[0];
+        flightProbe.macroEnergy[1]      = flightProbe.macroEnergy[0];
+    }
 
-    constexpr double kLinkSmoothingTauSec = 0.007;
-    const double aLink = onePoleAlpha (kLinkSmoothingTauSec, dt);
-    lastLink01Smoothed = aLink * lastLink01Smoothed + (1.0 - aLink) * link01;
-    const double link01Smooth = juce::jlimit (0.0, 1.0, lastLink01Smoothed);
+    // Note: detector/envelope is 2ch; additional channels are not part of the attenuation-link computation.
 
     const double linkedDb = juce::jmax (attnDbCh[0], attnDbCh[1]);
     const double outDbL0 = (1.0 - link01Smooth) * attnDbCh[0] + link01Smooth * linkedDb;
@@ -862,6 +1104,8 @@ void CompassMasteringLimiterAudioProcessor::processOneSample (float* const* chPt
         // Final application (hard-fenced): broadband scaling of post-link GR only
         outDbL *= finalScalar;
         outDbR *= finalScalar;
+
+        flightProbe.guardScalar = (float) finalScalar;
     }
 
     outDbL = juce::jlimit (0.0, kMaxAttnDb, outDbL);
@@ -883,13 +1127,13 @@ void CompassMasteringLimiterAudioProcessor::processOneSample (float* const* chPt
     lastAppliedAttnDb[0] = outDbL;
     lastAppliedAttnDb[1] = outDbR;
 
-    if (numCh >= 1 && std::isfinite (outDbL))
+    if (metersActive && numCh >= 1 && std::isfinite (outDbL))
     {
         const double grThisDb = juce::jlimit (0.0, 120.0, outDbL);
         grHoldDb[0] = juce::jmax (grHoldDb[0], grThisDb);
     }
 
-    if (numCh >= 2 && std::isfinite (outDbR))
+    if (metersActive && numCh >= 2 && std::isfinite (outDbR))
     {
         const double grThisDb = juce::jlimit (0.0, 120.0, outDbR);
         grHoldDb[1] = juce::jmax (grHoldDb[1], grThisDb);
@@ -902,6 +1146,8 @@ void CompassMasteringLimiterAudioProcessor::processOneSample (float* const* chPt
     if (grDbNeg < grDbNegMin)
         grDbNegMin = grDbNeg;
 
+    COMPASS_STAGE_LAP_SPLIT (stageLap, Guardrail);
+
     const float gL0 = (float) std::pow (10.0, -outDbL / 20.0);
     const float gR0 = (float) std::pow (10.0, -outDbR / 20.0);
 
@@ -912,22 +1158,60 @@ void CompassMasteringLimiterAudioProcessor::processOneSample (float* const* chPt
     lastOutScalar[0] = gL;
     lastOutScalar[1] = gR;
 
-    constexpr float kEpsAbs = 1.0e-12f;
-    constexpr float kSoftClipK = 1.25f;
-    constexpr float kCeilingKnee = 0.035f;
+    flightProbe.link01     = (float) link01Smooth;
+    flightProbe.outGain    = { gL, gR };
+    flightProbe.flags      = (overloadAssistOn ? FlightRecorder::kFlagAssist : 0u);
+
+    applyGainAndCeiling (chPtr, numCh, i, ceilingDb);
+}
+
+template <typename SampleType>
+void CompassMasteringLimiterAudioProcessor::applyGainAndCeiling (SampleType* const* chPtr,
+                                                                 int numCh,
+                                                                 int i,
+                                                                 double ceilingDb) noexcept
+{
+    COMPASS_STAGE_LAP_BEGIN (stageLap, stageCounters);
+
     float ceilingLin = (float) std::pow (10.0, ceilingDb / 20.0);
     if (! std::isfinite ((double) ceilingLin) || ceilingLin <= 0.0f)
         ceilingLin = 0.0f;
 
+    gainAndCeilingStage (chPtr, numCh, i, lastOutScalar[0], lastOutScalar[1],
+                         juce::jlimit (0.0, 1.0, lastLink01Smoothed), ceilingLin,
+                         ceilingGainState, ceilingGainStateLinked, ceilA_down, ceilA_up, lastCeilScalar);
+
+    COMPASS_STAGE_LAP_SPLIT (stageLap, Ceiling);
+}
+
+template <typename SampleType>
+void CompassMasteringLimiterAudioProcessor::gainAndCeilingStage (SampleType* const* chPtr,
+                                                                 int numCh,
+                                                                 int i,
+                                                                 float gL,
+                                                                 float gR,
+                                                                 double link01Smooth,
+                                                                 float ceilingLin,
+                                                                 float (&envState)[2],
+                                                                 float& envStateLinked,
+                                                                 float aDown,
+                                                                 float aUp,
+                                                                 std::array<float, 2>& ceilScalarOut) noexcept
+{
+    constexpr float kEpsAbs = 1.0e-12f;
+    constexpr float kCeilingKnee = 0.035f;
+
     if (numCh >= 2)
     {
-        float xL = chPtr[0][i];
-        float xR = chPtr[1][i];
+        SampleType xL = chPtr[0][i];
+        SampleType xR = chPtr[1][i];
         if (! std::isfinite ((double) xL)) xL = 0.0f;
         if (! std::isfinite ((double) xR)) xR = 0.0f;
 
-        float yL = xL * gL;
-        float yR = xR * gR;
+        SampleType yL = xL * gL;
+        SampleType yR = xR * gR;
+
+        ceilScalarOut = { 1.0f, 1.0f };
 
         if (ceilingLin > 0.0f)
         {
@@ -935,65 +1219,68 @@ void CompassMasteringLimiterAudioProcessor::processOneSample (float* const* chPt
 
             if (stereoLinked)
             {
-                const float aL = std::abs (yL);
-                const float aR = std::abs (yR);
+                const float aL = (float) std::abs (yL);
+                const float aR = (float) std::abs (yR);
                 const float aMax = juce::jmax (aL, aR);
 
                 float gReqLinked = (aMax > kEpsAbs ? (ceilingLin / aMax) : 1.0f);
                 if (! std::isfinite ((double) gReqLinked)) gReqLinked = 1.0f;
                 gReqLinked = juce::jlimit (0.0f, 1.0f, gReqLinked);
 
-                const float gCeilLinked = stepCeilingEnv (gReqLinked, ceilingGainStateLinked, ceilA_down, ceilA_up);
+                const float gCeilLinked = stepCeilingEnv (gReqLinked, envStateLinked, aDown, aUp);
                 yL *= gCeilLinked;
                 yR *= gCeilLinked;
+                ceilScalarOut = { gCeilLinked, gCeilLinked };
             }
             else
             {
                 // L (unlinked) — keep existing per-channel ceiling behavior
                 {
-                    const float a = std::abs (yL);
+                    const float a = (float) std::abs (yL);
                     float gReq = (a > kEpsAbs ? (ceilingLin / a) : 1.0f);
                     if (! std::isfinite ((double) gReq)) gReq = 1.0f;
                     gReq = juce::jlimit (0.0f, 1.0f, gReq);
 
-                    const float gCeil = stepCeilingEnv (gReq, ceilingGainState[0], ceilA_down, ceilA_up);
+                    const float gCeil = stepCeilingEnv (gReq, envState[0], aDown, aUp);
                     yL *= gCeil;
+                    ceilScalarOut[0] = gCeil;
                 }
 
                 // R (unlinked) — keep existing per-channel ceiling behavior
                 {
-                    const float a = std::abs (yR);
+                    const float a = (float) std::abs (yR);
                     float gReq = (a > kEpsAbs ? (ceilingLin / a) : 1.0f);
                     if (! std::isfinite ((double) gReq)) gReq = 1.0f;
                     gReq = juce::jlimit (0.0f, 1.0f, gReq);
 
-                    const float gCeil = stepCeilingEnv (gReq, ceilingGainState[1], ceilA_down, ceilA_up);
+                    const float gCeil = stepCeilingEnv (gReq, envState[1], aDown, aUp);
                     yR *= gCeil;
+                    ceilScalarOut[1] = gCeil;
                 }
             }
 
             // Post-ceiling softclip + hard margin (per-channel), unchanged behavior
             {
-                const float u = yL / ceilingLin;
-                const float a = std::abs (u);
+                const SampleType u = yL / ceilingLin;
+                const SampleType a = std::abs (u);
 
-                float w = (a - 1.0f) / kCeilingKnee;
-                w = juce::jlimit (0.0f, 1.0f, w);
+                SampleType w = (a - 1.0f) / kCeilingKnee;
+                w = juce::jlimit ((SampleType) 0, (SampleType) 1, w);
                 w = w * w * (3.0f - 2.0f * w); // smoothstep
 
-                const float ySat = ceilingLin * (u >= 0.0f ? 1.0f : -1.0f);
+                const SampleType ySat = ceilingLin * (u >= 0.0f ? 1.0f : -1.0f);
                 yL = yL + w * (ySat - yL);
             }
 
             {
-                const float u = yR / ceilingLin;
-                const float a = std::abs (u);
+                const SampleType u = yR / ceilingLin;
+                const SampleType a = std::abs (u);
 
-                float w = (a - 1.0f) / kCeilingKnee;
-                w = juce::jlimit (0.0f, 1.0f, w);
+                SampleType w = (a - 1.0f) / kCeilingKnee;
+                w = juce::jlimit ((SampleType) 0, (SampleType) 1, w);
                 w = w * w * (3.0f - 2.0f * w); // smoothstep
 
-                const float ySat = ceilingLin * (u >= 0.0f ? 1.0f : -1.0f);
+                const SampleType ySat = ceilingLin * (u >= 0.0f ? 1.0f : -1.0f);
                 yR = yR + w * (ySat - yR);
             }
         }
@@ -1005,29 +1292,32 @@ void CompassMasteringLimiterAudioProcessor::processOneSample (float* const* chPt
     }
     else if (numCh >= 1)
     {
-        float x = chPtr[0][i];
+        SampleType x = chPtr[0][i];
         if (! std::isfinite ((double) x)) x = 0.0f;
 
-        float y = x * gL;
+        SampleType y = x * gL;
+
+        ceilScalarOut = { 1.0f, 1.0f };
 
         if (ceilingLin > 0.0f)
         {
-            const float a = std::abs (y);
+            const float a = (float) std::abs (y);
             float gReq = (a > kEpsAbs ? (ceilingLin / a) : 1.0f);
             if (! std::isfinite ((double) gReq)) gReq = 1.0f;
             gReq = juce::jlimit (0.0f, 1.0f, gReq);
 
-            const float gCeil = stepCeilingEnv (gReq, ceilingGainState[0], ceilA_down, ceilA_up);
+            const float gCeil = stepCeilingEnv (gReq, envState[0], aDown, aUp);
             y *= gCeil;
+            ceilScalarOut = { gCeil, gCeil };
 
-            const float u = y / ceilingLin;
-            const float aU = std::abs (u);
+            const SampleType u = y / ceilingLin;
+            const SampleType aU = std::abs (u);
 
-            float w = (aU - 1.0f) / kCeilingKnee;
-            w = juce::jlimit (0.0f, 1.0f, w);
+            SampleType w = (aU - 1.0f) / kCeilingKnee;
+            w = juce::jlimit ((SampleType) 0, (SampleType) 1, w);
             w = w * w * (3.0f - 2.0f * w); // smoothstep
 
-            const float ySat = ceilingLin * (u >= 0.0f ? 1.0f : -1.0f);
+            const SampleType ySat = ceilingLin * (u >= 0.0f ? 1.0f : -1.0f);
             y = y + w * (ySat - y);
 
         }
@@ -1038,29 +1328,29 @@ void CompassMasteringLimiterAudioProcessor::processOneSample (float* const* chPt
 
     for (int c = 2; c < numCh; ++c)
     {
-        float x = chPtr[c][i];
+        SampleType x = chPtr[c][i];
         if (! std::isfinite ((double) x)) x = 0.0f;
 
-        float y = x * gR;
+        SampleType y = x * gR;
 
         if (ceilingLin > 0.0f)
         {
-            const float a = std::abs (y);
+            const float a = (float) std::abs (y);
             float gReq = (a > kEpsAbs ? (ceilingLin / a) : 1.0f);
             if (! std::isfinite ((double) gReq)) gReq = 1.0f;
             gReq = juce::jlimit (0.0f, 1.0f, gReq);
 
-            const float gCeil = stepCeilingEnv (gReq, ceilingGainState[1], ceilA_down, ceilA_up);
+            const float gCeil = stepCeilingEnv (gReq, envState[1], aDown, aUp);
             y *= gCeil;
 
-            const float u = y / ceilingLin;
-            const float aU = std::abs (u);
+            const SampleType u = y / ceilingLin;
+            const SampleType aU = std::abs (u);
 
-            float w = (aU - 1.0f) / kCeilingKnee;
-            w = juce::jlimit (0.0f, 1.0f, w);
+            SampleType w = (aU - 1.0f) / kCeilingKnee;
+            w = juce::jlimit ((SampleType) 0, (SampleType) 1, w);
             w = w * w * (3.0f - 2.0f * w); // smoothstep
 
-            const float ySat = ceilingLin * (u >= 0.0f ? 1.0f : -1.0f);
+            const SampleType ySat = ceilingLin * (u >= 0.0f ? 1.0f : -1.0f);
             y = y + w * (ySat - y);
 
         }
@@ -1068,71 +1358,434 @@ void CompassMasteringLimiterAudioProcessor::processOneSample (float* const* chPt
         if (! std::isfinite ((double) y)) y = 0.0f;
         chPtr[c][i] = y;
     }
+}
 
-    // Step 4 — Compute Output peak + RMS (broadband), linear domain (no dB).
-    // Guard: accumulators are 2ch; never index beyond [0..1].
-    const int chProcOut = juce::jmin (2, numCh);
-    for (int c = 0; c < chProcOut; ++c)
+// Phase 11 — Metering Plumbing: publishMeters (SPSC seqlock ring producer)
+void CompassMasteringLimiterAudioProcessor::publishMeters (const MeterSnapshot& s) noexcept
+{
+    meterRing.publish (s);
+}
+
+bool CompassMasteringLimiterAudioProcessor::readMeters (MeterReadout& out) const noexcept
+{
+    // Latest-snapshot policy; the dB conversion runs here, on the consumer thread.
+    MeterSnapshot s {};
+    if (! meterRing.readLatest (s))
+        return false;
+
+    out = meterReadoutFrom (s);
+    return true;
+}
+
+int CompassMasteringLimiterAudioProcessor::drainMeters (MeterDrain& aggregate,
+                                                        MeterHistoryPoint* history,
+                                                        int historyCapacity) const noexcept
+{
+    // Peak-preserving drain: every unread snapshot, oldest first; dB conversion on the consumer thread.
+    const int cap = (history != nullptr ? juce::jmax (0, historyCapacity) : 0);
+    int drained = 0;
+
+    MeterSnapshot s {};
+    while (meterRing.readNext (s))
     {
-        const double y = (double) chPtr[c][i];
-        const double outAbs = std::abs (y);
-        outPeakHold[(size_t) c] = juce::jmax (outPeakHold[(size_t) c], outAbs);
-        outRmsSq[(size_t) c] += (outAbs * outAbs);
+        const MeterReadout r = meterReadoutFrom (s);
+
+        MeterHistoryPoint p;
+        p.grDb        = (float) juce::jmax (r.grDb[0], r.grDb[1]);
+        p.outTpDb     = (float) juce::jmax (r.outTpDb[0], r.outTpDb[1]);
+        p.lufsShortDb = (float) r.lufsShortDb;
+
+        if (drained == 0)
+            aggregate = MeterDrain {};
+
+        for (int c = 0; c < 2; ++c)
+        {
+            aggregate.inTpDb[c]  = juce::jmax (aggregate.inTpDb[c],  (float) r.inTpDb[c]);
+            aggregate.outTpDb[c] = juce::jmax (aggregate.outTpDb[c], (float) r.outTpDb[c]);
+        }
+
+        aggregate.inPeakDb  = juce::jmax (aggregate.inPeakDb,  (float) juce::jmax (r.inPeakDb[0],  r.inPeakDb[1]));
+        aggregate.outPeakDb = juce::jmax (aggregate.outPeakDb, (float) juce::jmax (r.outPeakDb[0], r.outPeakDb[1]));
+        aggregate.grDb      = juce::jmax (aggregate.grDb, p.grDb);
+
+        // Newest wins for the windowed/integrated values.
+        aggregate.lufsShortDb = (float) r.lufsShortDb;
+        aggregate.lufsIntDb   = (float) r.lufsIntDb;
+
+        aggregate.cpu.p50                 = r.cpuLoadP50;
+        aggregate.cpu.p99                 = r.cpuLoadP99;
+        aggregate.cpu.max                 = r.cpuLoadMax;
+        aggregate.cpu.deadlineMisses      = r.cpuDeadlineMisses;
+        aggregate.cpu.assistActivations   = r.cpuAssistActivations;
+        aggregate.cpu.assistActive        = r.cpuAssistActive;
+        aggregate.cpu.overloadLevel       = (int) r.cpuOverloadLevel;
+        aggregate.cpu.overloadTransitions = r.cpuOverloadTransitions;
+
+        if (drained < cap)
+        {
+            history[drained] = p;
+        }
+        else if (cap > 0)
+        {
+            auto& last = history[cap - 1];
+            last.grDb        = juce::jmax (last.grDb,    p.grDb);
+            last.outTpDb     = juce::jmax (last.outTpDb, p.outTpDb);
+            last.lufsShortDb = p.lufsShortDb;
+        }
+
+        ++drained;
     }
+
+    return drained;
 }
 
-// Phase 11 — Metering Plumbing: publishMeters (SPSC ring producer)
-void CompassMasteringLimiterAudioProcessor::publishMeters (const MeterSnapshot& s) noexcept
+CompassMasteringLimiterAudioProcessor::MeterReadout
+CompassMasteringLimiterAudioProcessor::meterReadoutFrom (const MeterSnapshot& s) noexcept
 {
-    const uint32_t w = meterWriteIndex.load (std::memory_order_relaxed);
+    MeterReadout r;
 
-    meterRing[(size_t) w] = s;
+    constexpr double kEps = 1.0e-12;
 
-    const uint32_t wNext = (w + 1u) % kMeterRingCapacity;
-    const uint32_t r     = meterReadIndex.load (std::memory_order_relaxed);
+    auto linToDb = [] (double x) noexcept
+    {
+        if (! std::isfinite (x) || x < 0.0) x = 0.0;
+        x = juce::jlimit (0.0, 1.0e6, x);
+        return juce::jlimit (-120.0, 60.0, 20.0 * std::log10 (x + kEps));
+    };
+
+    for (int c = 0; c < 2; ++c)
+    {
+        r.inPeakDb[c]  = linToDb (s.inPeakLin[c]);
+        r.outPeakDb[c] = linToDb (s.outPeakLin[c]);
+        r.inTpDb[c]    = linToDb (s.inTpLin[c]);
+        r.outTpDb[c]   = linToDb (s.outTpLin[c]);
+
+        double x = s.grDb[c];
+        if (! std::isfinite (x) || x < 0.0) x = 0.0;
+        r.grDb[c] = juce::jlimit (0.0, 120.0, x);
+
+        r.clamp01[c] = s.clamp01[c];
+        r.glue01[c]  = s.glue01[c];
+    }
 
-    if (wNext == r)
+    // Crest factor (broadband): stereo peak minus stereo RMS.
+    // Stereo peak: max(L,R). Stereo RMS: max-energy channel (max sumSq) -> RMS dB.
     {
-        const uint32_t rNext = (r + 1u) % kMeterRingCapacity;
-        meterReadIndex.store (rNext, std::memory_order_relaxed);
+        const double win = (double) juce::jmax (1, (int) s.holdSamples);
+
+        const double inPeakStereoDb  = juce::jmax (r.inPeakDb[0],  r.inPeakDb[1]);
+        const double outPeakStereoDb = juce::jmax (r.outPeakDb[0], r.outPeakDb[1]);
+
+        auto rmsDb = [win] (double sumSq) noexcept
+        {
+            if (! std::isfinite (sumSq) || sumSq < 0.0) sumSq = 0.0;
+            sumSq = juce::jlimit (0.0, 1.0e12, sumSq);
+            double db = 10.0 * std::log10 ((sumSq / win) + kEps);
+            if (! std::isfinite (db)) db = -120.0;
+            return juce::jlimit (-120.0, 60.0, db);
+        };
+
+        const double inRmsStereoDb  = rmsDb (juce::jmax (s.inSumSq[0],  s.inSumSq[1]));
+        const double outRmsStereoDb = rmsDb (juce::jmax (s.outSumSq[0], s.outSumSq[1]));
+
+        double crest = inPeakStereoDb - inRmsStereoDb;
+        if (! std::isfinite (crest)) crest = 0.0;
+        r.crestPreDb = juce::jlimit (-60.0, 120.0, crest);
+
+        crest = outPeakStereoDb - outRmsStereoDb;
+        if (! std::isfinite (crest)) crest = 0.0;
+        r.crestPostDb = juce::jlimit (-60.0, 120.0, crest);
     }
 
-    meterWriteIndex.store (wNext, std::memory_order_relaxed);
+    // Loudness (Phase 11): unweighted energy, deterministic. Bounded for UI sanity.
+    {
+        constexpr double kEpsE   = 1.0e-18;
+        constexpr double kOffset = -0.691; // LUFS-style offset (unweighted here by constitution)
 
-    meterSeq.fetch_add (1u, std::memory_order_release);
+        auto lufsDb = [] (double e, double n) noexcept
+        {
+            double ms = (n > 0.0 ? (e / n) : 0.0);
+            if (! std::isfinite (ms) || ms < 0.0) ms = 0.0;
+            ms = juce::jlimit (0.0, 1.0e12, ms);
+
+            double db = kOffset + 10.0 * std::log10 (ms + kEpsE);
+            if (! std::isfinite (db)) db = -120.0;
+            return juce::jlimit (-120.0, 60.0, db);
+        };
+
+        r.lufsShortDb = lufsDb (s.lufsShortE, s.lufsShortN);
+        r.lufsIntDb   = lufsDb (s.lufsIntE,   s.lufsIntN);
+    }
+
+    r.cpuLoadP50             = s.cpuLoadP50;
+    r.cpuLoadP99             = s.cpuLoadP99;
+    r.cpuLoadMax             = s.cpuLoadMax;
+    r.cpuDeadlineMisses      = s.cpuDeadlineMisses;
+    r.cpuAssistActivations   = s.cpuAssistActivations;
+    r.cpuAssistActive        = s.cpuAssistActive;
+    r.cpuOverloadLevel       = s.cpuOverloadLevel;
+    r.cpuOverloadTransitions = s.cpuOverloadTransitions;
+    r.frameCounter           = s.frameCounter;
+
+    return r;
 }
 
-bool CompassMasteringLimiterAudioProcessor::readMeters (MeterSnapshot& out) const noexcept
+void CompassMasteringLimiterAudioProcessor::resetCpuLoadTelemetry() noexcept
 {
-    const uint32_t seqNow  = meterSeq.load (std::memory_order_acquire);
-    const uint32_t seqPrev = meterLastReadSeq.load (std::memory_order_relaxed);
+    cpuHist.fill (0u);
+    cpuHistTotal         = 0u;
+    cpuRatioMaxWindow    = 0.0;
+    cpuDeadlineMisses    = 0u;
+    cpuAssistActivations = 0u;
+}
+
+void CompassMasteringLimiterAudioProcessor::resetOverloadScheduler() noexcept
+{
+    overloadLevel       = 0;
+    overloadHoldBlocks  = 0;
+    overloadCalmBlocks  = 0;
+    overloadTransitions = 0u;
+}
+
+bool CompassMasteringLimiterAudioProcessor::stepOverloadScheduler (double deadlineRatio, bool realtime) noexcept
+{
+    if (! realtime || ! std::isfinite (deadlineRatio))
+    {
+        if (overloadLevel != 0)
+            ++overloadTransitions;
+
+        overloadLevel      = 0;
+        overloadHoldBlocks = 0;
+        overloadCalmBlocks = 0;
+        return false;
+    }
+
+    if (overloadHoldBlocks > 0)
+        --overloadHoldBlocks;
+
+    if (deadlineRatio > kOverloadDownRatio)
+    {
+        overloadCalmBlocks = 0;
+
+        // Hold: give the cheaper tier time to show its effect before stepping further down.
+        if (overloadLevel < kOverloadMaxLevel && overloadHoldBlocks == 0)
+        {
+            ++overloadLevel;
+            ++overloadTransitions;
+            overloadHoldBlocks = kOverloadHoldBlocks;
+            return (overloadLevel == 1);
+        }
 
-    // If nothing has ever been published, report "no data".
-    if (seqNow == 0u)
         return false;
+    }
+
+    if (overloadLevel > 0 && deadlineRatio < kOverloadUpRatio)
+    {
+        if (++overloadCalmBlocks >= kOverloadCalmBlocks)
+        {
+            --overloadLevel;
+            ++overloadTransitions;
+            overloadCalmBlocks = 0;
+        }
+    }
+    else
+    {
+        overloadCalmBlocks = 0;
+    }
 
-    const uint32_t w = meterWriteIndex.load (std::memory_order_relaxed);
-    const uint32_t idx = (w + kMeterRingCapacity - 1u) % kMeterRingCapacity;
+    return false;
+}
 
-    out = meterRing[(size_t) idx];
+void CompassMasteringLimiterAudioProcessor::recordBlockLoad (double deadlineRatio, bool assistEngaged) noexcept
+{
+    if (! std::isfinite (deadlineRatio) || deadlineRatio < 0.0)
+        return;
 
-    // Only advance the "last read" marker when a new publish occurred.
-    if (seqNow != seqPrev)
-        meterLastReadSeq.store (seqNow, std::memory_order_relaxed);
+    if (cpuHistTotal >= kCpuHistDecayAt)
+    {
+        cpuHistTotal = 0u;
+        for (auto& b : cpuHist)
+        {
+            b >>= 1;
+            cpuHistTotal += b;
+        }
+        cpuRatioMaxWindow = 0.0;
+    }
 
-    // Latest-snapshot policy: advance consumer index to keep producer's "ring full" test sane.
-    meterReadIndex.store (w, std::memory_order_relaxed);
+    const int bin = juce::jlimit (0, kCpuHistBins - 1, (int) (deadlineRatio * kCpuHistBinsPerUnit));
+    cpuHist[(size_t) bin] += 1u;
+    cpuHistTotal += 1u;
 
-    return true;
+    cpuRatioMaxWindow = juce::jmax (cpuRatioMaxWindow, deadlineRatio);
+
+    if (deadlineRatio >= 1.0)
+        ++cpuDeadlineMisses;
+
+    if (assistEngaged)
+        ++cpuAssistActivations;
 }
 
-void CompassMasteringLimiterAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midi)
+double CompassMasteringLimiterAudioProcessor::cpuHistPercentile (double q) const noexcept
 {
-    juce::ignoreUnused (midi);
-    juce::ScopedNoDenormals denormGuard;
+    if (cpuHistTotal == 0u)
+        return 0.0;
 
-    // FTZ/DAZ always on (JUCE-supported): prevents denormal CPU spikes on silence/tails.
-    juce::FloatVectorOperations::disableDenormalisedNumberSupport (true);
+    // Upper edge of the bin containing the q-quantile (conservative: never under-reports load).
+    const double target = juce::jlimit (0.0, 1.0, q) * (double) cpuHistTotal;
+    uint32_t acc = 0u;
+    for (int b = 0; b < kCpuHistBins; ++b)
+    {
+        acc += cpuHist[(size_t) b];
+        if ((double) acc >= target && acc > 0u)
+            return (b == kCpuHistBins - 1 ? juce::jmax ((double) b / kCpuHistBinsPerUnit, cpuRatioMaxWindow)
+                                          : (double) (b + 1) / kCpuHistBinsPerUnit);
+    }
+
+    return cpuRatioMaxWindow;
+}
+
+template <typename SampleType>
+void CompassMasteringLimiterAudioProcessor::accumulateLoudness (const juce::AudioBuffer<SampleType>& buffer) noexcept
+{
+    // Loudness update (Phase 11): from final native-rate output buffer (post-DSP).
+    // Deterministic, bounded, no allocations.
+    if (lufsChunkSamples > 0)
+    {
+        const int numCh = juce::jmin (2, buffer.getNumChannels());
+        const int n = buffer.getNumSamples();
+
+        for (int i = 0; i < n; ++i)
+        {
+            double e = 0.0;
+            if (numCh >= 2)
+            {
+                const double y0 = (double) buffer.getSample (0, i);
+                const double y1 = (double) buffer.getSample (1, i);
+                e = 0.5 * (y0 * y0 + y1 * y1);
+            }
+            else if (numCh == 1)
+            {
+                const double y0 = (double) buffer.getSample (0, i);
+                e = (y0 * y0);
+            }
+
+            if (! std::isfinite (e) || e < 0.0) e = 0.0;
+            e = juce::jlimit (0.0, 1.0e12, e);
+
+            lufsCurChunkE += e;
+            lufsCurChunkN += 1;
+
+            lufsIntSumE += e;
+            lufsIntN    += 1u;
+
+            if (lufsCurChunkN >= lufsChunkSamples)
+            {
+                const double oldE = lufsChunkE[(size_t) lufsChunkWrite];
+                if (lufsChunkFilled >= (uint32_t) kLufsShortChunks)
+                    lufsShortSumE -= oldE;
+                else
+                    lufsChunkFilled += 1u;
+
+                lufsChunkE[(size_t) lufsChunkWrite] = lufsCurChunkE;
+                lufsShortSumE += lufsCurChunkE;
+
+                lufsChunkWrite = (lufsChunkWrite + 1u) % (uint32_t) kLufsShortChunks;
+
+                lufsCurChunkE = 0.0;
+                lufsCurChunkN = 0;
+            }
+        }
+    }
+}
+
+void CompassMasteringLimiterAudioProcessor::publishMetersAtCadence (int numSamples) noexcept
+{
+    // Meter publish cadence (meterRateHzApplied). Publish latest holds (bounded), then reset holds.
+    // Audio thread: must remain allocation-free and lock-free. No consumer attached: nothing to publish.
+    if (meterPublishSamples > 0 && metersActive)
+    {
+        meterCountdown -= numSamples;
+        while (meterCountdown <= 0)
+        {
+            // Raw accumulators only: the consumer does the dB conversion (meterReadoutFrom).
+            MeterSnapshot s{};
+
+            for (int c = 0; c < 2; ++c)
+            {
+                s.inPeakLin[c]  = inPeakHold[c];
+                s.outPeakLin[c] = outPeakHold[c];
+                s.inTpLin[c]    = inTpHold[c];
+                s.outTpLin[c]   = outTpHold[c];
+                s.inSumSq[c]    = inRmsSq[c];
+                s.outSumSq[c]   = outRmsSq[c];
+                s.grDb[c]       = grHoldDb[c];
+            }
+            s.holdSamples = meterPublishSamples;
+
+            s.lufsShortE = lufsShortSumE + lufsCurChunkE;
+            s.lufsShortN = (double) lufsChunkFilled * (double) juce::jmax (1, lufsChunkSamples) + (double) lufsCurChunkN;
+            s.lufsIntE   = lufsIntSumE;
+            s.lufsIntN   = (double) lufsIntN;
+
+            // CPU load telemetry (histogram summary; blocks timed so far).
+            s.cpuLoadP50           = (float) cpuHistPercentile (0.50);
+            s.cpuLoadP99           = (float) cpuHistPercentile (0.99);
+            s.cpuLoadMax           = (float) cpuRatioMaxWindow;
+            s.cpuDeadlineMisses    = cpuDeadlineMisses;
+            s.cpuAssistActivations = cpuAssistActivations;
+            s.cpuAssistActive      = (overloadLevel > 0);
+            s.cpuOverloadLevel       = (uint8_t) overloadLevel;
+            s.cpuOverloadTransitions = overloadTransitions;
+            s.frameCounter           = ++meterFrameCounter;
+
+            publishMeters (s);
+            clearMeterHolds();
+
+            meterCountdown += meterPublishSamples;
+        }
+    }
+}
+
+void CompassMasteringLimiterAudioProcessor::updateMeterDemand() noexcept
+{
+    const bool active = (meterConsumers.load (std::memory_order_relaxed) > 0);
+    const int  rateHz = meterRateHzRequested.load (std::memory_order_relaxed);
+
+    if (active == metersActive && rateHz == meterRateHzApplied)
+        return;
+
+    // Holds gathered while nobody listened (or over a different period) are stale: restart one clean period.
+    metersActive       = active;
+    meterRateHzApplied = rateHz;
+
+    if (meterPublishSamples > 0)
+    {
+        meterPublishSamples = (int) juce::jmax (1.0, lastSampleRate / (double) meterRateHzApplied);
+        meterCountdown      = meterPublishSamples;
+    }
+
+    clearMeterHolds();
+}
+
+void CompassMasteringLimiterAudioProcessor::clearMeterHolds() noexcept
+{
+    for (int c = 0; c < 2; ++c)
+    {
+        inPeakHold[c]  = 0.0;
+        outPeakHold[c] = 0.0;
+        inRmsSq[c]     = 0.0;
+        outRmsSq[c]    = 0.0;
+        inTpHold[c]    = 0.0;
+        outTpHold[c]   = 0.0;
+        grHoldDb[c]    = 0.0;
+    }
+}
+
+template <typename SampleType>
+void CompassMasteringLimiterAudioProcessor::processBlockInternal (juce::AudioBuffer<SampleType>& buffer)
+{
+    // FTZ/DAZ for the whole callback (prevents denormal CPU spikes on silence/tails); restored on return.
+    juce::ScopedNoDenormals denormGuard;
 
     // NaN/Inf containment helpers
     auto isBadF = [] (float x) noexcept { return ! std::isfinite (x); };
@@ -1140,6 +1793,15 @@ void CompassMasteringLimiterAudioProcessor::processBlock (juce::AudioBuffer<floa
 
     badMathThisBlock = false;
 
+    // Housekeeping cadence (see kHousekeepingSamples): small host blocks amortize the fixed per-callback work.
+    const bool housekeepingNow = (housekeepingCountdown <= 0);
+    if (housekeepingNow)
+        housekeepingCountdown = kHousekeepingSamples;
+    housekeepingCountdown -= buffer.getNumSamples();
+
+    // Meter demand (editor / telemetry attach, publish rate) lands here, once per block.
+    updateMeterDemand();
+
    #if JUCE_DEBUG
     // Debug asserts for internal state invariants
     jassert (std::isfinite (truePeakLin));
@@ -1150,24 +1812,18 @@ void CompassMasteringLimiterAudioProcessor::processBlock (juce::AudioBuffer<floa
     jassert (rmsSqSum[0] >= -1.0e-9 && rmsSqSum[1] >= -1.0e-9);
    #endif
 
-    // Release containment: sanitize any bad carried state immediately (prevents propagation)
-    if (isBadD (truePeakLin) ||
+    // Release containment: sanitize any bad carried state (prevents propagation). Per-block NaN/Inf is
+    // caught by badMathThisBlock below; this scan only guards carried state, on the housekeeping cadence.
+    if (housekeepingNow && (isBadD (truePeakLin) ||
         isBadD (microStage1DbState[0]) || isBadD (microStage1DbState[1]) ||
         isBadD (microStage2DbState[0]) || isBadD (microStage2DbState[1]) ||
-        isBadD (macroEnergyState[0])   || isBadD (macroEnergyState[1]))
+        isBadD (macroEnergyState[0])   || isBadD (macroEnergyState[1])))
     {
         truePeakLin = 0.0;
         microStage1DbState = { 0.0, 0.0 };
         microStage2DbState = { 0.0, 0.0 };
         macroEnergyState   = { 0.0, 0.0 };
-        for (int c = 0; c < 2; ++c)
-        {
-            rmsSqSum[c] = 0.0;
-            rmsWriteIdx[c] = 0;
-            rmsSilenceCount[c] = 0;
-            for (int i = 0; i < kCrestRmsWinMaxN; ++i)
-                rmsSqRing[c][i] = 0.0;
-        }
+        resetCrestRmsWindows();
         eventDensityState  = { 0.0, 0.0 };
         guardLpState       = { 0.0, 0.0 };
         guardHpState2      = { 0.0, 0.0 };
@@ -1180,6 +1836,8 @@ void CompassMasteringLimiterAudioProcessor::processBlock (juce::AudioBuffer<floa
 
     // Gate-3 deterministic transport semantics:
     // transport stop/start resets adaptive/envelope/guard states and is the only safe boundary for oversampling selection.
+    // Polled on every callback: the reset lands on the block where the host reports the edge (only
+    // telemetry and the carried-state scan run on the housekeeping cadence).
     if (auto* ph = getPlayHead())
     {
         juce::AudioPlayHead::CurrentPositionInfo pos;
@@ -1194,17 +1852,7 @@ void CompassMasteringLimiterAudioProcessor::processBlock (juce::AudioBuffer<floa
             else if (playingNow != lastTransportPlaying)
             {
                 lastTransportPlaying = playingNow;
-
-                const int ch = juce::jmax (getTotalNumInputChannels(), getTotalNumOutputChannels());
-                reset (lastSampleRate, lastMaxBlock, ch);
-
-                ceilingGainState[0] = 1.0f;
-                ceilingGainState[1] = 1.0f;
-                ceilingGainStateLinked = 1.0f;
-
-                // Transport-safe boundary: latch oversampling selection (no allocations here).
-                const int osMinIndexBoundary = (int) apvts->getRawParameterValue ("oversampling_min")->load();
-                selectOversamplingAtBoundary (osMinIndexBoundary);
+                resetAtTransportBoundary();
             }
         }
     }
@@ -1215,48 +1863,87 @@ void CompassMasteringLimiterAudioProcessor::processBlock (juce::AudioBuffer<floa
     {
         lastNonRealtime = nonRealtimeNow;
 
-        const int ch = juce::jmax (getTotalNumInputChannels(), getTotalNumOutputChannels());
-        reset (lastSampleRate, lastMaxBlock, ch);
+        // Hosts may go offline without a fresh prepareToPlay: drop any realtime overload level before
+        // the boundary latches, or a bounce would render at the degraded factor throughout.
+        if (nonRealtimeNow)
+            resetOverloadScheduler();
+
+        resetAtTransportBoundary();
+    }
 
-        ceilingGainState[0] = 1.0f;
-        ceilingGainState[1] = 1.0f;
-        ceilingGainStateLinked = 1.0f;
+    // Phase 1.9 — Bypass crossfade target. The wet engine computes through the ramp, then is suspended.
+    const bool bypassedNow = (params.bypass->load() >= 0.5f);
 
-        const int osMinIndexBoundary = (int) apvts->getRawParameterValue ("oversampling_min")->load();
-        selectOversamplingAtBoundary (osMinIndexBoundary);
+    if (bypassedNow && ! bypassSuspended && bypassMix <= 0.0f)
+    {
+        // Ramp complete: freeze the engine where it is (no live switch survives the suspension).
+        bypassSuspended = true;
+        bypassPreRollRemaining = 0;
+        osSwitchTarget = -1;
+    }
+    else if (! bypassedNow && bypassSuspended)
+    {
+        // Resume warm: envelope/adaptive state is kept; only the oversampler FIRs hold stale audio.
+        // Pre-roll = FIR flush (twice the reported latency, as for the live-switch shadow) + envelope settle.
+        bypassSuspended = false;
+        bypassPreRollRemaining = 2 * getLatencySamples() + 32 + bypassSettleSamples;
+
+        if (activeOversampler != nullptr)
+            activeOversampler->reset();
+        if (activeOsTier < kOsCount)
+            osAlign[(size_t) activeOsTier].reset();
     }
 
-    // Phase 1.9 — Bypass crossfade target (wet keeps computing even when bypassed).
-    const auto* bp = getBypassParameter();
-    const bool bypassedNow = (bp != nullptr) && (bp->getValue() >= 0.5f);
     const float bypassTarget = (bypassedNow ? 0.0f : 1.0f);
     auto stepBypassMix = [&] () noexcept
     {
         constexpr float maxDelta = 0.01f;
-        const float d = bypassTarget - bypassMix;
+        float target = bypassTarget;
+        if (bypassPreRollRemaining > 0)
+        {
+            --bypassPreRollRemaining;
+            target = 0.0f;
+        }
+        const float d = target - bypassMix;
         const float step = juce::jlimit (-maxDelta, +maxDelta, d);
         bypassMix += step;
         bypassMix = juce::jlimit (0.0f, 1.0f, bypassMix);
     };
 
     // Gate-2 rule: read params once per block into locals (atomics -> locals).
-    const float driveDbTarget   = apvts->getRawParameterValue ("drive")->load();
-    const float ceilingDbTarget = apvts->getRawParameterValue ("ceiling")->load();
-    const float bias01Target    = apvts->getRawParameterValue ("adaptive_bias")->load();
-    const float link01Target    = apvts->getRawParameterValue ("stereo_link")->load();
-    const int   osMinIndex      = (int) apvts->getRawParameterValue ("oversampling_min")->load();
-    juce::ignoreUnused (osMinIndex);
+    const float driveDbTarget   = params.drive->load();
+    const float ceilingDbTarget = params.ceiling->load();
+    const float bias01Target    = params.adaptiveBias->load();
+    const float link01Target    = params.stereoLink->load();
+    const int   osMinIndex      = (int) params.oversamplingMin->load();
+
+    // Live oversampling switch request (realtime tiers only; nonrealtime renders keep boundary-only latching).
+    if (! nonRealtimeNow && ! bypassSuspended && osSwitchTarget < 0 && activeOsTier < kOsCount)
+    {
+        const int osWanted = realtimeOsTierFor (osMinIndex);
+        if (osWanted != activeOsTier)
+            beginOsSwitch (osWanted);
+    }
 
-    float trimDb = apvts->getRawParameterValue("trim")->load();
-    float trimLin = std::pow(10.0f, trimDb / 20.0f);
-    buffer.applyGain(trimLin);
+    COMPASS_STAGE_LAP_BEGIN (stageLap, stageCounters);
+
+    const float trimDb = params.trim->load();
+    if (trimDb != trimDbCached)
+    {
+        trimDbCached  = trimDb;
+        trimLinCached = std::pow (10.0f, trimDb / 20.0f);
+    }
+    applyTrim (buffer);
+
+    COMPASS_STAGE_LAP_SPLIT (stageLap, Trim);
 
     driveDbSmoothed.setTargetValue (driveDbTarget);
     ceilingDbSmoothed.setTargetValue (ceilingDbTarget);
     adaptiveBias01Smoothed.setTargetValue (bias01Target);
     stereoLink01Smoothed.setTargetValue (link01Target);
 
-    const auto tBlockStart = juce::Time::getHighResolutionTicks();
+    // Block timing is sampled with the housekeeping cadence (the scheduler sees one ratio per timed block).
+    const auto tBlockStart = (housekeepingNow ? juce::Time::getHighResolutionTicks() : 0);
 
     // Control-domain true peak measurement disabled in Phase0 (buffer-size CPU stress).
     // measureTruePeak (buffer);
@@ -1289,11 +1976,17 @@ void CompassMasteringLimiterAudioProcessor::processBlock (juce::AudioBuffer<floa
         constexpr double kCouple = 1.25;
 
         // Oversampled audio-path processing (no allocations in audio thread).
-        // Fallback to native-rate if scratch buffer is not prepared for this block size / channel count.
+        // Processed in kOsTileSamples tiles, so any host block size qualifies; native-rate fallback only
+        // when the scratch buffer is not prepared for this channel count.
         const bool canOsAudio =
+            oversamplingPathEnabled &&
             (activeOversampler != nullptr) &&
             (workBufferFloat.getNumChannels() >= numCh) &&
-            (workBufferFloat.getNumSamples()  >= n);
+            (workBufferFloat.getNumSamples()  >= kOsTileSamples);
+
+        // The shadow path needs every block of the switch; a native-rate fallback block abandons it.
+        if (! canOsAudio)
+            osSwitchTarget = -1;
 
         if (canOsAudio)
         {
@@ -1312,15 +2005,15 @@ void CompassMasteringLimiterAudioProcessor::processBlock (juce::AudioBuffer<floa
                     (std::abs (macroEnergyState[0])   <= kRestEn) &&
                     (std::abs (macroEnergyState[1])   <= kRestEn);
 
-                if (envAtRest)
+                if (envAtRest && ! bypassSuspended)
                 {
                     float peak = 0.0f;
                     for (int c = 0; c < numCh; ++c)
                     {
-                        const float* p = buffer.getReadPointer (c);
+                        const SampleType* p = buffer.getReadPointer (c);
                         for (int i = 0; i < n; ++i)
                         {
-                            const float a = std::abs (p[i]);
+                            const float a = (float) std::abs (p[i]);
                             if (a > peak) peak = a;
                         }
                     }
@@ -1338,102 +2031,254 @@ void CompassMasteringLimiterAudioProcessor::processBlock (juce::AudioBuffer<floa
                 }
             }
 
-            if (! skipOsFastPath)
-            {
+            AlignDelay& dryDelay = bypassDryFor (activeOsTier);
 
-            // Copy float -> double scratch (native-rate, length n)
-            for (int c = 0; c < numCh; ++c)
+            if (bypassSuspended)
             {
-                const float* src = buffer.getReadPointer (c);
-                float* dst = workBufferFloat.getWritePointer (c);
-                for (int i = 0; i < n; ++i)
-                    dst[i] = src[i];
-            }
+                // CPU-idle bypass: latency-matched dry only; control smoothers advance so targets are current on resume.
+                COMPASS_STAGE_LAP_RESTART (stageLap);
+                for (int t0 = 0; t0 < n; t0 += kOsTileSamples)
+                {
+                    const int nT = juce::jmin (kOsTileSamples, n - t0);
 
-            juce::dsp::AudioBlock<float> fullBlock (workBufferFloat);
-            auto blockN = fullBlock.getSubBlock (0, (size_t) n);
+                    for (int c = 0; c < numCh; ++c)
+                    {
+                        const SampleType* src = buffer.getReadPointer (c) + t0;
+                        float* dst = bypassDryBuffer.getWritePointer (c);
+                        for (int i = 0; i < nT; ++i)
+                            dst[i] = (float) src[i];
+                    }
 
-            juce::ScopedNoDenormals innerNoDenormals;
-            auto osBlock = activeOversampler->processSamplesUp (blockN);
+                    dryDelay.process (bypassDryBuffer.getArrayOfWritePointers(), numCh, nT);
 
-            const int osCh = (int) osBlock.getNumChannels();
-            const int osN  = (int) osBlock.getNumSamples();
+                    for (int c = 0; c < numCh; ++c)
+                    {
+                        const float* src = bypassDryBuffer.getReadPointer (c);
+                        SampleType* dst = buffer.getWritePointer (c) + t0;
+                        for (int i = 0; i < nT; ++i)
+                            dst[i] = (SampleType) src[i];
+                    }
+                }
 
-            const int osFactor = juce::jmax (1, (int) activeOversampler->getOversamplingFactor());
-            const double dtOS  = lastInvSampleRate / (double) osFactor;
+                driveDbSmoothed.skip (n);
+                ceilingDbSmoothed.skip (n);
+                adaptiveBias01Smoothed.skip (n);
+                stereoLink01Smoothed.skip (n);
 
-            // Cache oversampled channel pointers (hot path, no allocations)
-            constexpr int kOsChCacheMax = 8;
-            std::array<float*, (size_t) kOsChCacheMax> osPtr {};
-            const int osCached = juce::jmin (juce::jmin (numCh, osCh), kOsChCacheMax);
-            for (int c = 0; c < osCached; ++c)
-                osPtr[(size_t) c] = osBlock.getChannelPointer ((size_t) c);
+                if (gainCaptureL != nullptr)
+                {
+                    for (int i = 0; i < n && gainCaptureCount < gainCaptureCapacity; ++i)
+                    {
+                        gainCaptureL[gainCaptureCount] = 1.0f;
+                        gainCaptureR[gainCaptureCount] = 1.0f;
+                        ++gainCaptureCount;
+                    }
+                }
 
-            // Phase D: materialize a fixed pointer array for the sample helper (no allocation).
-            std::array<float*, (size_t) kOsChCacheMax> osPtrArr {};
-            const int numChEff = juce::jmin (juce::jmin (numCh, osCh), kOsChCacheMax);
-            for (int c = 0; c < numChEff; ++c)
-                osPtrArr[(size_t) c] = (c < osCached ? osPtr[(size_t) c] : osBlock.getChannelPointer ((size_t) c));
+                grDbForUI.store (0.0f, std::memory_order_relaxed);
+                COMPASS_STAGE_LAP_SPLIT (stageLap, BypassMix);
+            }
+            else if (! skipOsFastPath)
+            {
 
             double grDbNegMin = 0.0; // 0 dB (no reduction) down to -kMaxAttnDb
-            const int tpCh = juce::jmin (2, numChEff);
 
-            
+            const bool captureGain = (gainCaptureL != nullptr);
+            const bool flightOn = flightRecorder.acceptsFrames();
+            const float shadowCeilingLin = (float) std::pow (10.0, (double) ceilingDbTarget / 20.0);
 
+            // Overload level >= 2: control path once per native sample (first sub-sample, native dt);
+            // the remaining sub-samples only apply the held gain + ceiling stage (true-peak safety kept).
+            const bool controlAtNativeRate = (overloadLevel >= 2);
 
-            
-
+            juce::ScopedNoDenormals innerNoDenormals;
 
-            // Advance smoothers at native rate (one step per native sample), reuse values across osFactor sub-samples.
-            for (int iN = 0; iN < n; ++iN)
+            // Fixed native-rate tiles (kOsTileSamples): the oversampled working set stays cache-resident and
+            // any host block size takes this path. A live switch may complete between tiles.
+            for (int t0 = 0; t0 < n; t0 += kOsTileSamples)
             {
-                const double driveDb   = (double) driveDbSmoothed.getNextValue();
-                const double ceilingDb = (double) ceilingDbSmoothed.getNextValue();
-                const double bias01    = juce::jlimit (0.0, 1.0, (double) adaptiveBias01Smoothed.getNextValue());
-                const double link01    = juce::jlimit (0.0, 1.0, (double) stereoLink01Smoothed.getNextValue());
+                const int nT = juce::jmin (kOsTileSamples, n - t0);
+
+                COMPASS_STAGE_LAP_RESTART (stageLap);
+
+                const bool osSwitching = (osSwitchTarget >= 0);
 
-                for (int k = 0; k < osFactor; ++k)
+                // Copy host tile -> float scratch (native-rate, length nT); double hosts convert here, in the copy that exists anyway.
+                for (int c = 0; c < numCh; ++c)
                 {
-                    const int i = iN * osFactor + k;
-                    if (i >= osN)
-                        break;
+                    const SampleType* src = buffer.getReadPointer (c) + t0;
+                    float* dst = workBufferFloat.getWritePointer (c);
+                    for (int i = 0; i < nT; ++i)
+                        dst[i] = (float) src[i];
+
+                    if (osSwitching)
+                        juce::FloatVectorOperations::copy (osShadowBuffer.getWritePointer (c), dst, nT);
+
+                    // The dry delay runs every tile so its history is current whenever the ramp needs it.
+                    juce::FloatVectorOperations::copy (bypassDryBuffer.getWritePointer (c), dst, nT);
+                }
 
-                    for (int c = 0; c < tpCh; ++c)
+                dryDelay.process (bypassDryBuffer.getArrayOfWritePointers(), numCh, nT);
+
+                juce::dsp::AudioBlock<float> fullBlock (workBufferFloat);
+                auto blockN = fullBlock.getSubBlock (0, (size_t) nT);
+
+                auto osBlock = activeOversampler->processSamplesUp (blockN);
+
+                COMPASS_STAGE_LAP_SPLIT (stageLap, Upsample);
+
+                const int osCh = (int) osBlock.getNumChannels();
+                const int osN  = (int) osBlock.getNumSamples();
+
+                const int osFactor = juce::jmax (1, (int) activeOversampler->getOversamplingFactor());
+                const double dtOS  = lastInvSampleRate / (double) osFactor;
+
+                // Cache oversampled channel pointers (hot path, no allocations)
+                constexpr int kOsChCacheMax = 8;
+                std::array<float*, (size_t) kOsChCacheMax> osPtr {};
+                const int osCached = juce::jmin (juce::jmin (numCh, osCh), kOsChCacheMax);
+                for (int c = 0; c < osCached; ++c)
+                    osPtr[(size_t) c] = osBlock.getChannelPointer ((size_t) c);
+
+                // Phase D: materialize a fixed pointer array for the sample helper (no allocation).
+                std::array<float*, (size_t) kOsChCacheMax> osPtrArr {};
+                const int numChEff = juce::jmin (juce::jmin (numCh, osCh), kOsChCacheMax);
+                for (int c = 0; c < numChEff; ++c)
+                    osPtrArr[(size_t) c] = (c < osCached ? osPtr[(size_t) c] : osBlock.getChannelPointer ((size_t) c));
+
+                // True-peak holds feed only the published meters (no channels when no consumer is attached).
+                const int tpCh = (metersActive ? juce::jmin (2, numChEff) : 0);
+
+                const bool trackGain = (captureGain || osSwitching);
+                float* shadowGainL = (osSwitching ? osShadowGain.getWritePointer (0) : nullptr);
+                float* shadowGainR = (osSwitching ? osShadowGain.getWritePointer (1) : nullptr);
+
+                // Advance smoothers at native rate (one step per native sample), reuse values across osFactor sub-samples.
+                prepareParamRamps (nT);
+
+                // Native-rate measurement side pass reads the tile before it is overwritten by the downsampler.
+                const float* const* nativeIn = workBufferFloat.getArrayOfReadPointers();
+
+                for (int iN = 0; iN < nT; ++iN)
+                {
+                    measureNativeSample (nativeIn, numCh, iN);
+
+                    const ParamFrame pf = paramAt (iN);
+                    const double driveDb   = pf.driveDb;
+                    const double ceilingDb = pf.ceilingDb;
+                    const double bias01    = pf.bias01;
+                    const double link01    = pf.link01;
+
+                    // Deepest gain across this native sample's oversampled sub-samples: pre-ceiling for the
+                    // live-switch shadow (it runs its own ceiling stage), times the ceiling envelope for the capture.
+                    float gCapL = 1.0f;
+                    float gCapR = 1.0f;
+                    float gOutL = 1.0f;
+                    float gOutR = 1.0f;
+
+                    for (int k = 0; k < osFactor; ++k)
                     {
-                        const double a = std::abs ((double) osPtrArr[(size_t) c][i]);
-                        if (std::isfinite (a))
-                            inTpHold[(size_t) c] = juce::jmax (inTpHold[(size_t) c], a);
+                        const int i = iN * osFactor + k;
+                        if (i >= osN)
+                            break;
+
+                        for (int c = 0; c < tpCh; ++c)
+                        {
+                            const double a = std::abs ((double) osPtrArr[(size_t) c][i]);
+                            if (std::isfinite (a))
+                                inTpHold[(size_t) c] = juce::jmax (inTpHold[(size_t) c], a);
+                        }
+
+                        if (! controlAtNativeRate)
+                        {
+                            processOneSample (osPtrArr.data(), numChEff, i, dtOS, driveDb, ceilingDb, bias01, link01, grDbNegMin);
+                        }
+                        else if (k == 0)
+                        {
+                            processOneSample (osPtrArr.data(), numChEff, i, lastInvSampleRate, driveDb, ceilingDb, bias01, link01, grDbNegMin);
+                        }
+                        else
+                        {
+                            applyGainAndCeiling (osPtrArr.data(), numChEff, i, ceilingDb);
+                        }
+
+                        for (int c = 0; c < tpCh; ++c)
+                        {
+                            const double a = std::abs ((double) osPtrArr[(size_t) c][i]);
+                            if (std::isfinite (a))
+                                outTpHold[(size_t) c] = juce::jmax (outTpHold[(size_t) c], a);
+                        }
+
+                        if (trackGain)
+                        {
+                            gCapL = juce::jmin (gCapL, lastOutScalar[0]);
+                            gCapR = juce::jmin (gCapR, lastOutScalar[1]);
+                            gOutL = juce::jmin (gOutL, lastOutScalar[0] * lastCeilScalar[0]);
+                            gOutR = juce::jmin (gOutR, lastOutScalar[1] * lastCeilScalar[1]);
+                        }
                     }
 
-                    processOneSample (osPtrArr.data(), numChEff, i, dtOS, driveDb, ceilingDb, bias01, link01, grDbNegMin);
+                    if (osSwitching)
+                    {
+                        shadowGainL[iN] = gCapL;
+                        shadowGainR[iN] = gCapR;
+                    }
 
-                    for (int c = 0; c < tpCh; ++c)
+                    if (captureGain && gainCaptureCount < gainCaptureCapacity)
                     {
-                        const double a = std::abs ((double) osPtrArr[(size_t) c][i]);
-                        if (std::isfinite (a))
-                            outTpHold[(size_t) c] = juce::jmax (outTpHold[(size_t) c], a);
+                        gainCaptureL[gainCaptureCount] = gOutL;
+                        gainCaptureR[gainCaptureCount] = gOutR;
+                        ++gainCaptureCount;
                     }
+
+                    if (flightOn)
+                        flightRecorder.push (flightProbe);
                 }
-            }
 
-            grDbForUI.store ((float) juce::jlimit (0.0, 120.0, -grDbNegMin), std::memory_order_relaxed);
+                COMPASS_STAGE_LAP_RESTART (stageLap);
+                activeOversampler->processSamplesDown (blockN);
 
+                // Realtime tiers: pad to the common reported latency; then blend in a live switch, if any.
+                if (activeOsTier < kOsCount)
+                    osAlign[(size_t) activeOsTier].process (workBufferFloat.getArrayOfWritePointers(), numCh, nT);
 
-            activeOversampler->processSamplesDown (blockN);
+                if (osSwitching)
+                    processOsSwitchShadow (numCh, nT, shadowCeilingLin);
 
-            // Copy wet -> output with Phase 1.9 bypass crossfade (dry = input buffer).
-            for (int c = 0; c < numCh; ++c)
-            {
-                const float* src = workBufferFloat.getReadPointer (c); // wet
-                float* dst = buffer.getWritePointer (c);              // contains dry until we overwrite
-                for (int i = 0; i < n; ++i)
+                // Output meters on the native-rate wet tile, matching the input side (one accumulation per native sample).
                 {
-                    stepBypassMix();
-                    const float dry = dst[i];
-                    const float wet = src[i];
-                    dst[i] = bypassMix * wet + (1.0f - bypassMix) * dry;
+                    const float* const* nativeOut = workBufferFloat.getArrayOfReadPointers();
+                    for (int iN = 0; iN < nT; ++iN)
+                        measureNativeOutputSample (nativeOut, numCh, iN);
+                }
+
+                COMPASS_STAGE_LAP_SPLIT (stageLap, Downsample);
+
+                // Copy wet -> output with Phase 1.9 bypass crossfade (dry = input delayed by the reported latency).
+                // Every channel replays the same ramp: one step per native sample, independent of tiling.
+                const float bypassMixTileStart = bypassMix;
+                const int preRollTileStart = bypassPreRollRemaining;
+                for (int c = 0; c < numCh; ++c)
+                {
+                    bypassMix = bypassMixTileStart;
+                    bypassPreRollRemaining = preRollTileStart;
+
+                    const float* src = workBufferFloat.getReadPointer (c); // wet
+                    const float* drySrc = bypassDryBuffer.getReadPointer (c);
+                    SampleType* dst = buffer.getWritePointer (c) + t0;
+                    for (int i = 0; i < nT; ++i)
+                    {
+                        stepBypassMix();
+                        const SampleType dry = (SampleType) drySrc[i];
+                        const SampleType wet = (SampleType) src[i];
+                        dst[i] = bypassMix * wet + (1.0f - bypassMix) * dry;
+                    }
                 }
+
+                COMPASS_STAGE_LAP_SPLIT (stageLap, BypassMix);
             }
+
+            grDbForUI.store ((float) juce::jlimit (0.0, 120.0, -grDbNegMin), std::memory_order_relaxed);
             }
             else
             {
@@ -1455,38 +2300,51 @@ void CompassMasteringLimiterAudioProcessor::processBlock (juce::AudioBuffer<floa
             // Native-rate fallback (prior behavior). No allocations. Deterministic.
             // Phase 11 note: input TP is sample-peak here unless/until true-peak is enabled for this path; do not add a new OS path just for input TP.
             constexpr int kChCacheMax = 8;
-            std::array<float*, (size_t) kChCacheMax> chPtr {};
+            std::array<SampleType*, (size_t) kChCacheMax> chPtr {};
             const int chCached = juce::jmin (numCh, kChCacheMax);
             for (int c = 0; c < chCached; ++c)
                 chPtr[(size_t) c] = buffer.getWritePointer (c);
 
             // Phase D: materialize a fixed pointer array for the sample helper (no allocation).
-            std::array<float*, (size_t) kChCacheMax> chPtrArr {};
+            std::array<SampleType*, (size_t) kChCacheMax> chPtrArr {};
             const int numChEff = juce::jmin (numCh, kChCacheMax);
             for (int c = 0; c < numChEff; ++c)
                 chPtrArr[(size_t) c] = (c < chCached ? chPtr[(size_t) c] : buffer.getWritePointer (c));
 
             double grDbNegMin = 0.0; // 0 dB (no reduction) down to -kMaxAttnDb
+            const bool flightOn = flightRecorder.acceptsFrames();
 
             
 
 
+            int rampBase = 0;
+            int rampEnd  = 0;
+
             for (int i = 0; i < n; ++i)
             {
                 stepBypassMix();
 
-                const double driveDb   = (double) driveDbSmoothed.getNextValue();
-                const double ceilingDb = (double) ceilingDbSmoothed.getNextValue();
-                const double bias01    = juce::jlimit (0.0, 1.0, (double) adaptiveBias01Smoothed.getNextValue());
-                const double link01    = juce::jlimit (0.0, 1.0, (double) stereoLink01Smoothed.getNextValue());
+                // Parameter ramps are prepared one kOsTileSamples span at a time.
+                if (i == rampEnd)
+                {
+                    rampBase = i;
+                    rampEnd  = i + juce::jmin (kOsTileSamples, n - i);
+                    prepareParamRamps (rampEnd - rampBase);
+                }
+
+                const ParamFrame pf = paramAt (i - rampBase);
+                const double driveDb   = pf.driveDb;
+                const double ceilingDb = pf.ceilingDb;
+                const double bias01    = pf.bias01;
+                const double link01    = pf.link01;
 
                 constexpr int kChCacheMax = 8;
-                std::array<float, (size_t) kChCacheMax> drySnap {};
+                std::array<SampleType, (size_t) kChCacheMax> drySnap {};
                 const int numChSnap = juce::jmin (numChEff, kChCacheMax);
                 for (int c = 0; c < numChSnap; ++c)
                     drySnap[(size_t) c] = chPtrArr[(size_t) c][i];
 
-                const int tpCh = juce::jmin (2, numChEff);
+                const int tpCh = (metersActive ? juce::jmin (2, numChEff) : 0);
                 for (int c = 0; c < tpCh; ++c)
                 {
                     const double a = std::abs ((double) chPtrArr[(size_t) c][i]);
@@ -1494,17 +2352,31 @@ void CompassMasteringLimiterAudioProcessor::processBlock (juce::AudioBuffer<floa
                         inTpHold[(size_t) c] = juce::jmax (inTpHold[(size_t) c], a);
                 }
 
+                measureNativeSample (chPtrArr.data(), numChEff, i);
                 processOneSample (chPtrArr.data(), numChEff, i, lastInvSampleRate, driveDb, ceilingDb, bias01, link01, grDbNegMin);
+                measureNativeOutputSample (chPtrArr.data(), numChEff, i);
+
+                if (gainCaptureL != nullptr && gainCaptureCount < gainCaptureCapacity)
+                {
+                    gainCaptureL[gainCaptureCount] = lastOutScalar[0] * lastCeilScalar[0];
+                    gainCaptureR[gainCaptureCount] = lastOutScalar[1] * lastCeilScalar[1];
+                    ++gainCaptureCount;
+                }
+
+                if (flightOn)
+                    flightRecorder.push (flightProbe);
 
                 // Phase 1.9 bypass blend: wet already computed into chPtrArr; drySnap preserves raw input for this sample.
                 if (bypassMix < 1.0f)
                 {
+                    COMPASS_STAGE_LAP_RESTART (stageLap);
                     for (int c = 0; c < numChSnap; ++c)
                     {
-                        const float wet = chPtrArr[(size_t) c][i];
-                        const float dry = drySnap[(size_t) c];
+                        const SampleType wet = chPtrArr[(size_t) c][i];
+                        const SampleType dry = drySnap[(size_t) c];
                         chPtrArr[(size_t) c][i] = bypassMix * wet + (1.0f - bypassMix) * dry;
                     }
+                    COMPASS_STAGE_LAP_SPLIT (stageLap, BypassMix);
                 }
             }
 
@@ -1512,184 +2384,36 @@ void CompassMasteringLimiterAudioProcessor::processBlock (juce::AudioBuffer<floa
         }
     }
 
-    // Loudness update (Phase 11): from final native-rate output buffer (post-DSP).
-    // Deterministic, bounded, no allocations.
-    if (meterPublishSamples > 0)
-    {
-        const int numCh = juce::jmin (2, buffer.getNumChannels());
-        const int n = buffer.getNumSamples();
-
-        for (int i = 0; i < n; ++i)
-        {
-            double e = 0.0;
-            if (numCh >= 2)
-            {
-                const double y0 = (double) buffer.getSample (0, i);
-                const double y1 = (double) buffer.getSample (1, i);
-                e = 0.5 * (y0 * y0 + y1 * y1);
-            }
-            else if (numCh == 1)
-            {
-                const double y0 = (double) buffer.getSample (0, i);
-                e = (y0 * y0);
-            }
-
-            if (! std::isfinite (e) || e < 0.0) e = 0.0;
-            e = juce::jlimit (0.0, 1.0e12, e);
-
-            lufsCurChunkE += e;
-            lufsCurChunkN += 1;
-
-            lufsIntSumE += e;
-            lufsIntN    += 1u;
-
-            if (lufsCurChunkN >= meterPublishSamples)
-            {
-                const double oldE = lufsChunkE[(size_t) lufsChunkWrite];
-                if (lufsChunkFilled >= (uint32_t) kLufsShortChunks)
-                    lufsShortSumE -= oldE;
-                else
-                    lufsChunkFilled += 1u;
-
-                lufsChunkE[(size_t) lufsChunkWrite] = lufsCurChunkE;
-                lufsShortSumE += lufsCurChunkE;
-
-                lufsChunkWrite = (lufsChunkWrite + 1u) % (uint32_t) kLufsShortChunks;
-
-                lufsCurChunkE = 0.0;
-                lufsCurChunkN = 0;
-            }
-        }
-    }
-
-    // Meter publish cadence (~50 Hz). Publish latest holds (bounded), then reset holds.
-    // Audio thread: must remain allocation-free and lock-free.
-    if (meterPublishSamples > 0)
-    {
-        meterCountdown -= buffer.getNumSamples();
-        while (meterCountdown <= 0)
-        {
-            MeterSnapshot s{};
-
-            constexpr double kEps = 1.0e-12;
-
-            for (int c = 0; c < 2; ++c)
-            {
-                double x = inPeakHold[c];
-                if (! std::isfinite (x) || x < 0.0) x = 0.0;
-                x = juce::jlimit (0.0, 1.0e6, x);
-                double db = 20.0 * std::log10 (x + kEps);
-                s.inPeakDb[c] = juce::jlimit (-120.0, 60.0, db);
-
-                x = outPeakHold[c];
-                if (! std::isfinite (x) || x < 0.0) x = 0.0;
-                x = juce::jlimit (0.0, 1.0e6, x);
-                db = 20.0 * std::log10 (x + kEps);
-                s.outPeakDb[c] = juce::jlimit (-120.0, 60.0, db);
-
-                x = inTpHold[c];
-                if (! std::isfinite (x) || x < 0.0) x = 0.0;
-                x = juce::jlimit (0.0, 1.0e6, x);
-                db = 20.0 * std::log10 (x + kEps);
-                s.inTpDb[c] = juce::jlimit (-120.0, 60.0, db);
-
-                x = outTpHold[c];
-                if (! std::isfinite (x) || x < 0.0) x = 0.0;
-                x = juce::jlimit (0.0, 1.0e6, x);
-                db = 20.0 * std::log10 (x + kEps);
-                s.outTpDb[c] = juce::jlimit (-120.0, 60.0, db);
-
-                x = grHoldDb[c];
-                if (! std::isfinite (x) || x < 0.0) x = 0.0;
-                s.grDb[c] = juce::jlimit (0.0, 120.0, x);
-            }
-
-            // Crest factor (broadband): stereo peak minus stereo RMS.
-            // Stereo peak: max(L,R). Stereo RMS: max-energy channel (max sumSq) -> RMS dB.
-            {
-                const double win = (double) juce::jmax (1, meterPublishSamples);
-
-                const double inPeakStereoDb  = juce::jmax (s.inPeakDb[0],  s.inPeakDb[1]);
-                const double outPeakStereoDb = juce::jmax (s.outPeakDb[0], s.outPeakDb[1]);
-
-                double inSumSqSel = juce::jmax (inRmsSq[0], inRmsSq[1]);
-                if (! std::isfinite (inSumSqSel) || inSumSqSel < 0.0) inSumSqSel = 0.0;
-                inSumSqSel = juce::jlimit (0.0, 1.0e12, inSumSqSel);
-                double inRmsStereoDb = 10.0 * std::log10 ((inSumSqSel / win) + kEps);
-                if (! std::isfinite (inRmsStereoDb)) inRmsStereoDb = -120.0;
-                inRmsStereoDb = juce::jlimit (-120.0, 60.0, inRmsStereoDb);
-
-                double outSumSqSel = juce::jmax (outRmsSq[0], outRmsSq[1]);
-                if (! std::isfinite (outSumSqSel) || outSumSqSel < 0.0) outSumSqSel = 0.0;
-                outSumSqSel = juce::jlimit (0.0, 1.0e12, outSumSqSel);
-                double outRmsStereoDb = 10.0 * std::log10 ((outSumSqSel / win) + kEps);
-                if (! std::isfinite (outRmsStereoDb)) outRmsStereoDb = -120.0;
-                outRmsStereoDb = juce::jlimit (-120.0, 60.0, outRmsStereoDb);
-
-                double crest = inPeakStereoDb - inRmsStereoDb;
-                if (! std::isfinite (crest)) crest = 0.0;
-                s.crestPreDb = juce::jlimit (-60.0, 120.0, crest);
-
-                crest = outPeakStereoDb - outRmsStereoDb;
-                if (! std::isfinite (crest)) crest = 0.0;
-                s.crestPostDb = juce::jlimit (-60.0, 120.0, crest);
-            }
-
-            // Loudness (Phase 11): unweighted energy, deterministic. Bounded for UI sanity.
-            {
-                constexpr double kEps = 1.0e-18;
-                constexpr double kOffset = -0.691; // LUFS-style offset (unweighted here by constitution)
-
-                const double shortE = lufsShortSumE + lufsCurChunkE;
-                const double shortN = (double) (lufsChunkFilled) * (double) juce::jmax (1, meterPublishSamples) + (double) lufsCurChunkN;
-                double msShort = (shortN > 0.0 ? (shortE / shortN) : 0.0);
-                if (! std::isfinite (msShort) || msShort < 0.0) msShort = 0.0;
-                msShort = juce::jlimit (0.0, 1.0e12, msShort);
-
-                double lufsShort = kOffset + 10.0 * std::log10 (msShort + kEps);
-                if (! std::isfinite (lufsShort)) lufsShort = -120.0;
-                s.lufsShortDb = juce::jlimit (-120.0, 60.0, lufsShort);
-
-                const double intN = (double) lufsIntN;
-                double msInt = (intN > 0.0 ? (lufsIntSumE / intN) : 0.0);
-                if (! std::isfinite (msInt) || msInt < 0.0) msInt = 0.0;
-                msInt = juce::jlimit (0.0, 1.0e12, msInt);
-
-                double lufsInt = kOffset + 10.0 * std::log10 (msInt + kEps);
-                if (! std::isfinite (lufsInt)) lufsInt = -120.0;
-                s.lufsIntDb = juce::jlimit (-120.0, 60.0, lufsInt);
-            }
-
-            publishMeters (s);
-
-            for (int c = 0; c < 2; ++c)
-            {
-                inPeakHold[c]  = 0.0;
-                outPeakHold[c] = 0.0;
-                inRmsSq[c]     = 0.0;
-                outRmsSq[c]    = 0.0;
-                inTpHold[c]    = 0.0;
-                outTpHold[c]   = 0.0;
-                grHoldDb[c]    = 0.0;
-            }
+    // Loudness update (Phase 11) + meter publish cadence (~50 Hz).
+    COMPASS_STAGE_LAP_RESTART (stageLap);
+    accumulateLoudness (buffer);
+    COMPASS_STAGE_LAP_SPLIT (stageLap, Loudness);
+    publishMetersAtCadence (buffer.getNumSamples());
+    COMPASS_STAGE_LAP_SPLIT (stageLap, MeterPublish);
 
-            meterCountdown += meterPublishSamples;
-        }
-    }
+    // Flight recorder: non-finite math takes precedence over an overload freeze in the same block
+    // (ring holds the offending samples; containment below clears the buffer/state afterwards).
+    if (badMathThisBlock)
+        flightRecorder.freeze (FlightRecorder::Trigger::NonFiniteMath);
 
-    // CPU overload behavior: if we exceed a conservative share of block duration, enable assist briefly.
+    // CPU overload behavior: graded degradation scheduler driven by the timed block's deadline ratio.
+    if (housekeepingNow)
     {
         const auto tEnd = juce::Time::getHighResolutionTicks();
         const double elapsedSec = juce::Time::highResolutionTicksToSeconds (tEnd - tBlockStart);
         const int n = buffer.getNumSamples();
         const double blockSec = (lastSampleRate > 0.0 ? (double) n / lastSampleRate : 0.0);
 
-        // If we're close to the deadline, disable guardrails extras for a short period.
-        if (blockSec > 0.0 && elapsedSec > 0.85 * blockSec)
-            overloadAssistBlocks = juce::jmax (overloadAssistBlocks, 64);
+        // Nonrealtime renders have no deadline: degrading there would make offline output depend on machine speed.
+        if (blockSec > 0.0)
+        {
+            const double ratio = (overloadLoadOverride >= 0.0 ? overloadLoadOverride : elapsedSec / blockSec);
+            const bool engaged = stepOverloadScheduler (ratio, ! nonRealtimeNow);
+            recordBlockLoad (ratio, engaged);
 
-        if (overloadAssistBlocks > 0)
-            --overloadAssistBlocks;
+            if (engaged)
+                flightRecorder.freeze (FlightRecorder::Trigger::OverloadAssist);
+        }
     }
 
     // NaN/Inf containment (release): if we tripped bad math, force safe output and reset state.
@@ -1702,14 +2426,7 @@ void CompassMasteringLimiterAudioProcessor::processBlock (juce::AudioBuffer<floa
         microStage1DbState = { 0.0, 0.0 };
         microStage2DbState = { 0.0, 0.0 };
         macroEnergyState   = { 0.0, 0.0 };
-        for (int c = 0; c < 2; ++c)
-        {
-            rmsSqSum[c] = 0.0;
-            rmsWriteIdx[c] = 0;
-            rmsSilenceCount[c] = 0;
-            for (int i = 0; i < kCrestRmsWinMaxN; ++i)
-                rmsSqRing[c][i] = 0.0;
-        }
+        resetCrestRmsWindows();
         eventDensityState  = { 0.0, 0.0 };
         guardLpState       = { 0.0, 0.0 };
         guardHpState2      = { 0.0, 0.0 };
@@ -1725,6 +2442,23 @@ void CompassMasteringLimiterAudioProcessor::processBlock (juce::AudioBuffer<floa
         buffer.clear (ch, 0, buffer.getNumSamples());
 }
 
+void CompassMasteringLimiterAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midi)
+{
+    juce::ignoreUnused (midi);
+    processBlockInternal (buffer);
+}
+
+void CompassMasteringLimiterAudioProcessor::processBlock (juce::AudioBuffer<double>& buffer, juce::MidiBuffer& midi)
+{
+    juce::ignoreUnused (midi);
+    processBlockInternal (buffer);
+}
+
+juce::AudioProcessorParameter* CompassMasteringLimiterAudioProcessor::getBypassParameter() const
+{
+    return apvts->getParameter ("bypass");
+}
+
 void CompassMasteringLimiterAudioProcessor::processBlockBypassed (juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midi)
 {
     juce::ignoreUnused (midi);
@@ -1736,6 +2470,16 @@ void CompassMasteringLimiterAudioProcessor::processBlockBypassed (juce::AudioBuf
         buffer.clear (ch, 0, buffer.getNumSamples());
 }
 
+void CompassMasteringLimiterAudioProcessor::processBlockBypassed (juce::AudioBuffer<double>& buffer, juce::MidiBuffer& midi)
+{
+    juce::ignoreUnused (midi);
+    juce::ScopedNoDenormals noDenormals;
+
+    // True bypass (double host): identical semantics to the float overload.
+    for (int ch = getTotalNumInputChannels(); ch < getTotalNumOutputChannels(); ++ch)
+        buffer.clear (ch, 0, buffer.getNumSamples());
+}
+
 void CompassMasteringLimiterAudioProcessor::getStateInformation (juce::MemoryBlock& destData)
 {
     // Session reload must restore identical internal state.
@@ -1775,22 +2519,28 @@ void CompassMasteringLimiterAudioProcessor::setStateInformation (const void* dat
     // Constitution: recall/reload must restore identical internal state.
     // Do not hard-reset adaptive/envelope/guard state here.
     // Sync smoothed parameters to loaded values (no ramp) to prevent discontinuities.
-    const float driveDb   = apvts->getRawParameterValue ("drive")->load();
-    const float ceilingDb = apvts->getRawParameterValue ("ceiling")->load();
-    const float bias01    = apvts->getRawParameterValue ("adaptive_bias")->load();
-    const float link01    = apvts->getRawParameterValue ("stereo_link")->load();
+    const float driveDb   = params.drive->load();
+    const float ceilingDb = params.ceiling->load();
+    const float bias01    = params.adaptiveBias->load();
+    const float link01    = params.stereoLink->load();
 
     driveDbSmoothed.setCurrentAndTargetValue (driveDb);
     ceilingDbSmoothed.setCurrentAndTargetValue (ceilingDb);
     adaptiveBias01Smoothed.setCurrentAndTargetValue (bias01);
     stereoLink01Smoothed.setCurrentAndTargetValue (link01);
+
+    trimDbCached  = params.trim->load();
+    trimLinCached = std::pow (10.0f, trimDbCached / 20.0f);
+    trimLinSmoothed.setCurrentAndTargetValue (trimLinCached);
 }
 
 
 void CompassMasteringLimiterAudioProcessor::prepareOversampling (int channels, int maxBlock)
 {
+    // processBlock feeds the oversamplers in fixed tiles: size everything for one tile, not the host block.
+    juce::ignoreUnused (maxBlock);
     const int ch = juce::jmax (1, channels);
-    const int mb = juce::jmax (1, maxBlock);
+    const int mb = kOsTileSamples;
 
     // Prebuild 2x/4x/8x with FIR equiripple halfband filters (linear-phase).
     for (int i = 0; i < kOsCount; ++i)
@@ -1803,72 +2553,302 @@ void CompassMasteringLimiterAudioProcessor::prepareOversampling (int channels, i
             true
         );
 
+        // Integer latency (fractional remainder absorbed by the oversampler) keeps tier padding exact.
+        oversamplers[(size_t) i]->setUsingIntegerLatency (true);
         oversamplers[(size_t) i]->initProcessing ((size_t) mb);
         oversamplers[(size_t) i]->reset();
 
-        oversamplerLatencySamples[(size_t) i] = oversamplers[(size_t) i]->getLatencyInSamples();
+        oversamplerLatencySamples[(size_t) i] = (int) oversamplers[(size_t) i]->getLatencyInSamples();
+        oversamplerUpLatencySamples[(size_t) i] = measureUpsamplerLatency (*oversamplers[(size_t) i], ch);
+        osTierCoeffs[(size_t) i] = computeOsTierCoeffs (1 << stages);
     }
 
+    // Live switch: every realtime tier is padded to the deepest tier's latency.
+    osRealtimeLatencySamples = 0;
+    for (int i = 0; i < kOsCount; ++i)
+        osRealtimeLatencySamples = juce::jmax (osRealtimeLatencySamples, oversamplerLatencySamples[(size_t) i]);
+
+    for (int i = 0; i < kOsCount; ++i)
+        osAlign[(size_t) i].prepare (ch, osRealtimeLatencySamples - oversamplerLatencySamples[(size_t) i]);
+
+    // Shadow warm-up covers the target's FIR chain twice over; fade 10 ms at the native rate.
+    osSwitchTarget        = -1;
+    osSwitchPos           = 0;
+    osSwitchWarmupSamples = 2 * osRealtimeLatencySamples + 32;
+    osSwitchFadeSamples   = juce::jmax (1, (int) std::ceil (0.010 * juce::jmax (1.0, lastSampleRate)));
+    osShadowBuffer.setSize (ch, mb, false, false, true);
+    osShadowGain.setSize (2, mb, false, false, true);
+
+    // Bypass dry path: delayed by the common realtime latency; un-bypass pre-roll settles the envelopes for 20 ms.
+    bypassDry.prepare (ch, osRealtimeLatencySamples);
+    bypassDryBuffer.setSize (ch, mb, false, false, true);
+    bypassSettleSamples = juce::jmax (1, (int) std::ceil (0.020 * juce::jmax (1.0, lastSampleRate)));
+
     // Scratch buffer for input conversion (double precision).
     workBufferFloat.setSize (ch, mb, false, false, true);
 
     // Default active oversampler is 2x until boundary latch selects otherwise.
     activeOversampler = oversamplers[0].get();
-    setLatencySamples (oversamplerLatencySamples[0]);
+    activeOsTier = 0;
+    applyOsTierCoeffs (0);
+    setLatencySamples (osRealtimeLatencySamples);
+}
+
+void CompassMasteringLimiterAudioProcessor::prepareOfflineOversampling (int channels, int maxBlock)
+{
+    juce::ignoreUnused (maxBlock);
+    const int ch = juce::jmax (1, channels);
+    const int mb = kOsTileSamples;
+
+    // Unpublish first: the audio thread only touches these after an acquire of the ready flag.
+    offlineOversamplersReady.store (false, std::memory_order_release);
+
+    // 16x/32x with the same FIR equiripple halfband chain as the realtime tiers. The factor constructor stops
+    // at 16x (4 stages), so the chain is built stage by stage with its max-quality schedule; stages past the
+    // fourth repeat the fourth stage's design (the stopband schedule loosens by 10 dB per stage).
+    for (int i = 0; i < kOsOfflineCount; ++i)
+    {
+        const int stages = kOsCount + 1 + i; // 4->16x, 5->32x
+        auto os = std::make_unique<juce::dsp::Oversampling<float>> ((size_t) ch);
+
+        for (int s = 0; s < stages; ++s)
+        {
+            const float twScale = (s == 0 ? 0.5f : 1.0f);
+            const float n = (float) juce::jmin (s, 3);
+            os->addOversamplingStage (juce::dsp::Oversampling<float>::filterHalfBandFIREquiripple,
+                                      0.10f * twScale, -90.0f + 10.0f * n,
+                                      0.12f * twScale, -75.0f + 10.0f * n);
+        }
+
+        offlineOversamplers[(size_t) i] = std::move (os);
+
+        offlineOversamplers[(size_t) i]->setUsingIntegerLatency (true);
+        offlineOversamplers[(size_t) i]->initProcessing ((size_t) mb);
+        offlineOversamplers[(size_t) i]->reset();
+
+        offlineOversamplerLatencySamples[(size_t) i] = (int) offlineOversamplers[(size_t) i]->getLatencyInSamples();
+        offlineOversamplerUpLatencySamples[(size_t) i] = measureUpsamplerLatency (*offlineOversamplers[(size_t) i], ch);
+        osTierCoeffs[(size_t) (kOsCount + i)] = computeOsTierCoeffs (1 << stages);
+        bypassDryOffline[(size_t) i].prepare (ch, offlineOversamplerLatencySamples[(size_t) i]);
+    }
+
+    offlineOversamplersReady.store (true, std::memory_order_release);
+}
+
+void CompassMasteringLimiterAudioProcessor::releaseOfflineOversampling()
+{
+    offlineOversamplersReady.store (false, std::memory_order_release);
+
+    for (int i = 0; i < kOsOfflineCount; ++i)
+    {
+        if (activeOversampler == offlineOversamplers[(size_t) i].get())
+        {
+            activeOversampler = oversamplers[(size_t) latchedOsMinIndex].get();
+            activeOsTier = latchedOsMinIndex;
+            applyOsTierCoeffs (activeOsTier);
+        }
+
+        offlineOversamplers[(size_t) i].reset();
+        offlineOversamplerLatencySamples[(size_t) i] = 0;
+        offlineOversamplerUpLatencySamples[(size_t) i] = 0;
+    }
+}
+
+int CompassMasteringLimiterAudioProcessor::realtimeOsTierFor (int osMinIndex) const noexcept
+{
+    // Overload level 3: one factor below the user's minimum.
+    return juce::jlimit (0, kOsCount - 1, osMinIndex - (overloadLevel >= 3 ? 1 : 0));
 }
 
 void CompassMasteringLimiterAudioProcessor::selectOversamplingAtBoundary (int osMinIndex) noexcept
 {
-    const int idx = juce::jlimit (0, kOsCount - 1, osMinIndex);
+    const int idx = realtimeOsTierFor (osMinIndex);
     latchedOsMinIndex = idx;
 
+    // A boundary supersedes any live switch in progress.
+    osSwitchTarget = -1;
+    osSwitchPos    = 0;
+
     auto* os = oversamplers[(size_t) idx].get();
+    int tier = idx;
+    int osLatency = osRealtimeLatencySamples;
+
+    // Offline tier (nonrealtime only): replaces the realtime selection when built and requested.
+    const int offlineTier = juce::jlimit (0, kOsOfflineCount, (int) params.oversamplingOffline->load());
+    if (isNonRealtime() && offlineTier > 0 && offlineOversamplersReady.load (std::memory_order_acquire))
+    {
+        if (auto* osOffline = offlineOversamplers[(size_t) (offlineTier - 1)].get())
+        {
+            os = osOffline;
+            tier = kOsCount + offlineTier - 1;
+            osLatency = offlineOversamplerLatencySamples[(size_t) (offlineTier - 1)];
+        }
+    }
+
     if (os != nullptr)
     {
         activeOversampler = os;
-        const int osFactor = juce::jmax (1, (int) activeOversampler->getOversamplingFactor());
-        const double fsDet = lastSampleRate * (double) osFactor;
+        activeOsTier = tier;
 
-        // Phase 1.7 Priority 4: dynamic guardrail HPF cutoff at detector rate
-        const double fsSafe = juce::jmax (1.0, fsDet);
-        const double kGuardFcHz = fsSafe / 5.5;
+        // Phase 1.7 Priority 4 guardrail HPF / low-shelf + ceiling envelope at the detector rate (precomputed).
+        applyOsTierCoeffs (tier);
 
-        // Existing 2nd-order Butterworth HPF topology (same normalization), cutoff replaced with kGuardFcHz
-        const double w0 = 2.0 * juce::MathConstants<double>::pi * kGuardFcHz / fsSafe;
-        const double cw = std::cos (w0);
-        const double sw = std::sin (w0);
-        constexpr double Q = 0.7071067811865476;
-        const double alpha = sw / (2.0 * Q);
-        const double b0 = (1.0 + cw) * 0.5;
-        const double b1 = -(1.0 + cw);
-        const double b2 = (1.0 + cw) * 0.5;
-        const double a0 = (1.0 + alpha);
-        const double a1 = -(2.0 * cw);
-        const double a2 = (1.0 - alpha);
-        guardNb0 = b0 / a0;
-        guardNb1 = b1 / a0;
-        guardNb2 = b2 / a0;
-        guardNa1 = a1 / a0;
-        guardNa2 = a2 / a0;
-
-        // Phase 1.7 Priority 4: 1st-order low-shelf post-compensation (+3 dB @ 200 Hz), detector-rate bilinear prewarp
-        const double gainDb = 3.0;
-        const double fc = 200.0;
-        const double omega = 2.0 * fsSafe * std::tan (juce::MathConstants<double>::pi * fc / fsSafe);
-        const double A = std::pow (10.0, gainDb / 40.0);
-        const double b0s = (1.0 + A * omega) / (1.0 + omega);
-        const double b1s = (A * omega - 1.0) / (1.0 + omega);
-        const double a1s = (omega - 1.0) / (1.0 + omega);
-
-        lowShelfB0 = b0s;
-        lowShelfB1 = b1s;
-        lowShelfA1 = a1s;
-
-        setLatencySamples (oversamplerLatencySamples[(size_t) idx]);
+        setLatencySamples (osLatency);
 
         // Deterministic, transport-safe boundary behavior:
         // reset oversampler state only when latching selection (not per block).
         activeOversampler->reset();
+        if (tier < kOsCount)
+            osAlign[(size_t) tier].reset();
+        bypassDryFor (tier).reset();
+    }
+}
+
+int CompassMasteringLimiterAudioProcessor::measureUpsamplerLatency (juce::dsp::Oversampling<float>& os, int channels)
+{
+    // getLatencyInSamples() is the up + down round trip, and the up/down halfband chains are designed with
+    // different transition widths, so the up share is not half of it. A linear-phase FIR chain maps a unit
+    // impulse to a peak at its group delay: that peak, in native samples, is where the engine sees input 0.
+    juce::AudioBuffer<float> probe (juce::jmax (1, channels), kOsTileSamples);
+    probe.clear();
+    for (int c = 0; c < probe.getNumChannels(); ++c)
+        probe.setSample (c, 0, 1.0f);
+
+    os.reset();
+    juce::dsp::AudioBlock<float> block (probe);
+    const auto up = os.processSamplesUp (block);
+
+    const float* p = up.getChannelPointer (0);
+    const int upN = (int) up.getNumSamples();
+    int peakAt = 0;
+    for (int i = 1; i < upN; ++i)
+        if (std::abs (p[i]) > std::abs (p[peakAt]))
+            peakAt = i;
+
+    os.reset();
+
+    const int factor = juce::jmax (1, (int) os.getOversamplingFactor());
+    return (peakAt + factor / 2) / factor;
+}
+
+CompassMasteringLimiterAudioProcessor::OsTierCoeffs
+CompassMasteringLimiterAudioProcessor::computeOsTierCoeffs (int osFactor) const noexcept
+{
+    OsTierCoeffs k;
+
+    const double fsDet = lastSampleRate * (double) juce::jmax (1, osFactor);
+    const double fsSafe = juce::jmax (1.0, fsDet);
+
+    // Step 3.1 — ceiling envelope runs at the detector rate of this tier (same clamps as reset()).
+    const float srEnv   = (float) fsSafe;
+    const float tauDown = juce::jmax (1.0e-5f, ceilingAttackMs  * 0.001f);
+    const float tauUp   = juce::jmax (1.0e-5f, ceilingReleaseMs * 0.001f);
+
+    float aDown = std::expf (-1.0f / (tauDown * srEnv));
+    float aUp   = std::expf (-1.0f / (tauUp   * srEnv));
+
+    if (! std::isfinite ((double) aDown)) aDown = 0.0f;
+    if (! std::isfinite ((double) aUp))   aUp   = 0.0f;
+
+    k.ceilA_down = juce::jlimit (1.0e-6f, 0.999999f, aDown);
+    k.ceilA_up   = juce::jlimit (1.0e-6f, 0.999999f, aUp);
+
+    return k;
+}
+
+void CompassMasteringLimiterAudioProcessor::applyOsTierCoeffs (int tier) noexcept
+{
+    const auto& k = osTierCoeffs[(size_t) juce::jlimit (0, kOsCount + kOsOfflineCount - 1, tier)];
+
+    ceilA_down = k.ceilA_down;
+    ceilA_up   = k.ceilA_up;
+}
+
+void CompassMasteringLimiterAudioProcessor::beginOsSwitch (int tier) noexcept
+{
+    if (tier < 0 || tier >= kOsCount || oversamplers[(size_t) tier] == nullptr)
+        return;
+
+    oversamplers[(size_t) tier]->reset();
+    osAlign[(size_t) tier].reset();
+
+    // The envelope state is a gain (rate-independent): the shadow continues from the active path's.
+    osShadowCeilState[0]    = ceilingGainState[0];
+    osShadowCeilState[1]    = ceilingGainState[1];
+    osShadowCeilStateLinked = ceilingGainStateLinked;
+
+    osSwitchTarget = tier;
+    osSwitchPos    = 0;
+}
+
+void CompassMasteringLimiterAudioProcessor::processOsSwitchShadow (int numCh, int n, float ceilingLin) noexcept
+{
+    auto* target = oversamplers[(size_t) osSwitchTarget].get();
+
+    juce::dsp::AudioBlock<float> shadowFull (osShadowBuffer);
+    auto shadowN = shadowFull.getSubBlock (0, (size_t) n);
+
+    // Shadow wet: target-rate upsample, active path's gain (held across the sub-samples), then the same
+    // ceiling envelope + softclip stage as the active path, on the shadow's envelope at the target's rate.
+    {
+        auto up = target->processSamplesUp (shadowN);
+        const int f   = juce::jmax (1, (int) target->getOversamplingFactor());
+        const int upN = (int) up.getNumSamples();
+
+        constexpr int kOsChCacheMax = 8;
+        std::array<float*, (size_t) kOsChCacheMax> upPtr {};
+        const int upC = juce::jmin (juce::jmin (numCh, (int) up.getNumChannels()), kOsChCacheMax);
+        for (int c = 0; c < upC; ++c)
+            upPtr[(size_t) c] = up.getChannelPointer ((size_t) c);
+
+        const float* gL = osShadowGain.getReadPointer (0);
+        const float* gR = osShadowGain.getReadPointer (1);
+        const auto& k = osTierCoeffs[(size_t) osSwitchTarget];
+        const double link01Smooth = juce::jlimit (0.0, 1.0, lastLink01Smoothed);
+
+        for (int i = 0; i < upN; ++i)
+            gainAndCeilingStage (upPtr.data(), upC, i, gL[i / f], gR[i / f], link01Smooth, ceilingLin,
+                                 osShadowCeilState, osShadowCeilStateLinked, k.ceilA_down, k.ceilA_up,
+                                 osShadowCeilScalar);
+
+        target->processSamplesDown (shadowN);
+    }
+
+    osAlign[(size_t) osSwitchTarget].process (osShadowBuffer.getArrayOfWritePointers(), numCh, n);
+
+    // Warm-up (shadow discarded) then linear crossfade active -> shadow, aligned sample-for-sample.
+    for (int c = 0; c < numCh; ++c)
+    {
+        float* wet = workBufferFloat.getWritePointer (c);
+        const float* sh = osShadowBuffer.getReadPointer (c);
+
+        for (int i = 0; i < n; ++i)
+        {
+            const int pos = osSwitchPos + i - osSwitchWarmupSamples;
+            if (pos < 0)
+                continue;
+
+            const float w = juce::jmin (1.0f, (float) (pos + 1) / (float) osSwitchFadeSamples);
+            wet[i] += w * (sh[i] - wet[i]);
+        }
+    }
+
+    osSwitchPos += n;
+
+    if (osSwitchPos >= osSwitchWarmupSamples + osSwitchFadeSamples)
+    {
+        activeOversampler = target;
+        activeOsTier      = osSwitchTarget;
+        latchedOsMinIndex = osSwitchTarget;
+        applyOsTierCoeffs (osSwitchTarget);
+
+        // The output is fully the shadow's now: its ceiling envelope carries on as the active one.
+        ceilingGainState[0]    = osShadowCeilState[0];
+        ceilingGainState[1]    = osShadowCeilState[1];
+        ceilingGainStateLinked = osShadowCeilStateLinked;
+
+        osSwitchTarget = -1;
+        osSwitchPos    = 0;
     }
 }
 
@@ -2001,6 +2981,11 @@ void CompassMasteringLimiterAudioProcessor::measureTruePeak (const juce::AudioBu
         resetTruePeakDetector();
 }
 
+// Explicit instantiations for out-of-TU stage access (compass_bench via CompassBenchAccess).
+template void CompassMasteringLimiterAudioProcessor::processOneSample<float> (float* const*, int, int, double, double, double, double, double, double&) noexcept;
+template void CompassMasteringLimiterAudioProcessor::measureNativeSample<float> (const float* const*, int, int) noexcept;
+template void CompassMasteringLimiterAudioProcessor::accumulateLoudness<float> (const juce::AudioBuffer<float>&) noexcept;
+
 juce::AudioProcessorEditor* CompassMasteringLimiterAudioProcessor::createEditor()
 {
     return new CompassMasteringLimiterAudioProcessorEditor (*this);
@@ -7,6 +7,10 @@
 #include <atomic>
 #include <cstdint>
 
+#include "FlightRecorder.h"
+#include "MeterTransport.h"
+#include "StageProfiler.h"
+
 class CompassMasteringLimiterAudioProcessor final : public juce::AudioProcessor
 {
 public:
@@ -17,11 +21,20 @@ public:
 
     void prepareToPlay (double sampleRate, int samplesPerBlock) override;
     void releaseResources() override;
+    void setNonRealtime (bool isNonRealtimeNow) noexcept override;
 
     bool isBusesLayoutSupported (const BusesLayout& layouts) const override;
 
+    // Double-precision hosts get a native double path (no host-side float conversion per callback).
+    bool supportsDoublePrecisionProcessing() const override { return true; }
+
     void processBlock (juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
+    void processBlock (juce::AudioBuffer<double>&, juce::MidiBuffer&) override;
     void processBlockBypassed (juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
+    void processBlockBypassed (juce::AudioBuffer<double>&, juce::MidiBuffer&) override;
+
+    // Host bypass is owned by the plugin: processBlock keeps running and handles the bypass ramp itself.
+    juce::AudioProcessorParameter* getBypassParameter() const override;
 
     juce::AudioProcessorEditor* createEditor() override;
     bool hasEditor() const override { return true; }
@@ -46,9 +59,24 @@ public:
 
     float getCurrentGRDb() const noexcept { return grDbForUI.load(std::memory_order_relaxed); }
 
+    // Meter consumers (counted). The latest-value getters below may be polled from any thread; drainMeters
+    // belongs to a single consumer thread. Peak / true-peak / RMS / GR holds and the snapshot publish run only
+    // while at least one consumer (editor, telemetry reader) is attached: with none, the readers below see no new
+    // snapshots. The loudness accumulators always run, so integrated loudness stays exact across attach/detach.
+    void attachMeterConsumer() noexcept { meterConsumers.fetch_add (1, std::memory_order_relaxed); }
+    void detachMeterConsumer() noexcept { meterConsumers.fetch_sub (1, std::memory_order_relaxed); }
+
+    // Snapshot publish rate (default 50 Hz); applied at the next block boundary.
+    static constexpr int kMeterRateHzMin = 1;
+    static constexpr int kMeterRateHzMax = 200;
+    void setMeterPublishRateHz (int hz) noexcept
+    {
+        meterRateHzRequested.store (juce::jlimit (kMeterRateHzMin, kMeterRateHzMax, hz), std::memory_order_relaxed);
+    }
+
     bool getCurrentTruePeakDbTP (float& inDbTP, float& outDbTP) const noexcept
     {
-        MeterSnapshot s{};
+        MeterReadout s{};
         if (! readMeters (s))
             return false;
 
@@ -66,7 +94,7 @@ public:
     bool getCurrentTruePeakDbTP_LR (float& inLDbTP, float& inRDbTP,
                                    float& outLDbTP, float& outRDbTP) const noexcept
     {
-        MeterSnapshot s{};
+        MeterReadout s{};
         if (! readMeters (s))
             return false;
 
@@ -85,7 +113,7 @@ public:
 
     bool getCurrentLufsDb (float& lufsS, float& lufsI) const noexcept
     {
-        MeterSnapshot s{};
+        MeterReadout s{};
         if (! readMeters (s))
             return false;
 
@@ -99,7 +127,7 @@ public:
 
     bool getCurrentPeakDbFS (float& inDbFS, float& outDbFS) const noexcept
     {
-        MeterSnapshot s{};
+        MeterReadout s{};
         if (! readMeters (s))
             return false;
 
@@ -114,15 +142,27 @@ public:
         return true;
     }
 
+    // Broadband crest factor (stereo peak minus stereo RMS over the publish period), input and output.
+    bool getCurrentCrestDb (float& preDb, float& postDb) const noexcept
+    {
+        MeterReadout s{};
+        if (! readMeters (s))
+            return false;
+
+        preDb  = (float) s.crestPreDb;
+        postDb = (float) s.crestPostDb;
+        return true;
+    }
+
     float getCurrentCeilingDbTP() const noexcept
     {
-        const float v = apvts->getRawParameterValue ("ceiling")->load();
+        const float v = params.ceiling->load();
         return (float) juce::jlimit (-120.0f, 60.0f, v);
     }
 
     bool getCurrentClampGlue01 (float& outClamp01, float& outGlue01) const noexcept
     {
-        MeterSnapshot s{};
+        MeterReadout s{};
         if (! readMeters (s))
             return false;
 
@@ -134,16 +174,179 @@ public:
         return true;
     }
 
+    // CPU load telemetry (deadline ratio = processBlock wall time / block duration; 1.0 = deadline).
+    struct CpuLoadStats final
+    {
+        float    p50 = 0.0f;
+        float    p99 = 0.0f;
+        float    max = 0.0f;                 // max over the current histogram window
+        uint32_t deadlineMisses    = 0u;     // blocks with ratio >= 1.0 since prepare
+        uint32_t assistActivations = 0u;     // overload-assist engagements (level 0 -> 1) since prepare
+        bool     assistActive      = false;  // overloadLevel > 0
+        int      overloadLevel     = 0;      // graded degradation tier (0 = full quality .. kOverloadMaxLevel)
+        uint32_t overloadTransitions = 0u;   // level changes (either direction) since prepare
+    };
+
+    bool getCpuLoadStats (CpuLoadStats& out) const noexcept
+    {
+        MeterReadout s{};
+        if (! readMeters (s))
+            return false;
+
+        out.p50 = s.cpuLoadP50;
+        out.p99 = s.cpuLoadP99;
+        out.max = s.cpuLoadMax;
+        out.deadlineMisses    = s.cpuDeadlineMisses;
+        out.assistActivations = s.cpuAssistActivations;
+        out.assistActive      = s.cpuAssistActive;
+        out.overloadLevel       = (int) s.cpuOverloadLevel;
+        out.overloadTransitions = s.cpuOverloadTransitions;
+        return true;
+    }
+
+    // Meter drain (one consumer thread only; e.g. the editor's display callback). The getters above return the newest
+    // snapshot only, so a consumer polling slower than the publish rate would miss the peaks in between.
+    // drainMeters walks every unread snapshot oldest-first: peaks, true peaks and GR fold as max, loudness and
+    // CPU come from the newest one. One history point per snapshot goes to `history` (in publication order);
+    // snapshots beyond historyCapacity fold into the last point, so no peak is dropped there either.
+    static constexpr int kMeterRingCapacity = 128; // fixed, no allocations; also the most a drain can return
+
+    struct MeterHistoryPoint final
+    {
+        float grDb        = 0.0f;     // stereo GR magnitude (max L/R), dB
+        float outTpDb     = -120.0f;  // stereo output true peak (max L/R), dBTP
+        float lufsShortDb = -120.0f;
+    };
+
+    struct MeterDrain final
+    {
+        float inTpDb[2]   { -120.0f, -120.0f };
+        float outTpDb[2]  { -120.0f, -120.0f };
+        float inPeakDb    = -120.0f;  // stereo
+        float outPeakDb   = -120.0f;
+        float grDb        = 0.0f;     // stereo GR magnitude (max L/R)
+        float lufsShortDb = -120.0f;
+        float lufsIntDb   = -120.0f;
+        CpuLoadStats cpu;
+    };
+
+    // Returns the number of snapshots drained (0: nothing new; `aggregate` untouched).
+    int drainMeters (MeterDrain& aggregate, MeterHistoryPoint* history, int historyCapacity) const noexcept;
+
     // Phase 1.4 — deterministic probes (non-realtime; callable from tests/debug harness)
     double probeSettleTimeSec (double sampleRate) const noexcept;
     bool probeContinuityFastAutomation (double sampleRate, double& outMaxAbsDeltaDb) const noexcept;
 
+    // Offline render — gain envelope capture (compute-once, apply-to-stems).
+    // Records the final per-sample linear gain (post link, guardrails and slew, times the ceiling envelope gain),
+    // one value per native sample (min across oversampled sub-samples), into caller-owned storage.
+    // The post-ceiling softclip is a waveshaper, not a gain, and is not captured.
+    // Not for realtime hosts: set/clear only while processBlock is not running. No allocations.
+    void setGainCaptureTarget (float* gainL, float* gainR, int capacitySamples) noexcept
+    {
+        gainCaptureL        = gainL;
+        gainCaptureR        = gainR;
+        gainCaptureCapacity = (gainL != nullptr && gainR != nullptr ? juce::jmax (0, capacitySamples) : 0);
+        gainCaptureCount    = 0;
+    }
+
+    int getGainCaptureCount() const noexcept { return gainCaptureCount; }
+
+    // Native samples by which the captured gain leads the input timeline: capture index (j + n) acts on input j.
+    // Up-sampling path of the active tier only (the reported latency also covers down-sampling + tier padding).
+    int getGainCaptureLatencySamples() const noexcept
+    {
+        return (activeOsTier < kOsCount ? oversamplerUpLatencySamples[(size_t) juce::jmax (0, activeOsTier)]
+                                        : offlineOversamplerUpLatencySamples[(size_t) juce::jlimit (0, kOsOfflineCount - 1, activeOsTier - kOsCount)]);
+    }
+
+    // Anomaly flight recorder (post-mortem evidence for non-finite math / overload-assist events).
+    // Off unless enabled here (no ring, thread or disk access by default). Configure before prepareToPlay.
+    // backgroundWriter=false starts no thread: frozen windows wait for writePendingFlightRecord().
+    void enableFlightRecorder (const juce::File& dir, bool backgroundWriter)
+    {
+        flightRecorder.setEnabled (true);
+        flightRecorder.setOutputDirectory (dir);
+        flightRecorder.setBackgroundWriter (backgroundWriter);
+    }
+
+    juce::File writePendingFlightRecord() { return flightRecorder.writePendingDump(); }
+
+    // Oversampling factor currently driving the wet path (1 before prepareToPlay).
+    int getActiveOversamplingFactor() const noexcept
+    {
+        return (activeOversampler != nullptr ? juce::jmax (1, (int) activeOversampler->getOversamplingFactor()) : 1);
+    }
+    int getFlightRecordCount() const noexcept { return flightRecorder.getDumpCount(); }
+
+    // Linked single-chain envelope (default on). Engages only while both chains would compute the same values,
+    // so output is bit-identical either way; false forces the two-chain reference path (reference_tests).
+    // Set only while processBlock is not running.
+    void setLinkedFastPathEnabled (bool enabled) noexcept { linkedFastPathEnabled = enabled; }
+
+    // Overload scheduler test hook: a ratio >= 0 replaces the measured deadline ratio of every timed block
+    // (deterministic level sequences; CPU telemetry sees the injected ratio too). < 0 (default) measures.
+    // Set only while processBlock is not running.
+    void setOverloadLoadOverride (double deadlineRatio) noexcept { overloadLoadOverride = deadlineRatio; }
+    int getOverloadLevel() const noexcept { return overloadLevel; }
+
+    // Oversampled wet path (default on). Disabling it runs the native-rate engine in the host's sample type,
+    // uncompensated against the reported latency: reference_tests only. Set only while processBlock is not running.
+    void setOversamplingPathEnabled (bool enabled) noexcept { oversamplingPathEnabled = enabled; }
+
+    // True while the bypass ramp has completed and the wet engine is suspended (dry delay only).
+    bool isBypassSuspended() const noexcept { return bypassSuspended; }
+
+    // Phase 12 stage profiling counters of this instance (zero unless COMPASS_ENABLE_STAGE_PROFILING).
+    // Read/reset only while processBlock is not running.
+    const compass::StageCounters& getStageCounters() const noexcept { return stageCounters; }
+    void resetStageCounters() noexcept { stageCounters.reset(); }
+
 private:
+    // compass_bench: stage-level timing harness (defined in compass_bench/Source/main.cpp only).
+    friend struct CompassBenchAccess;
+
     static APVTS::ParameterLayout createParameterLayout();
 
-    // Meter snapshot (POD, numeric-only). UI may consume via future plumbing.
-    // Step 1.1: declare the data structure only (no instances, no publication mechanism yet).
+    // Meter snapshot (POD, numeric-only): raw linear accumulators as the audio thread holds them.
+    // No transcendental math on the producer side; the consumer converts (meterReadoutFrom).
     struct MeterSnapshot final
+    {
+        double   inPeakLin[2]  { 0.0, 0.0 };
+        double   outPeakLin[2] { 0.0, 0.0 };
+
+        double   inTpLin[2]    { 0.0, 0.0 };
+        double   outTpLin[2]   { 0.0, 0.0 };
+
+        double   inSumSq[2]    { 0.0, 0.0 }; // sum of squares over holdSamples
+        double   outSumSq[2]   { 0.0, 0.0 };
+        int32_t  holdSamples   = 0;          // publish period the holds/sums cover
+
+        double   grDb[2]       { 0.0, 0.0 }; // attenuation magnitude in dB (0..+; the envelope is dB-domain)
+
+        double   lufsShortE    = 0.0;        // energy sum / sample count, short-term window
+        double   lufsShortN    = 0.0;
+        double   lufsIntE      = 0.0;        // energy sum / sample count, integrated
+        double   lufsIntN      = 0.0;
+
+        float   clamp01[2]     { 0.0f, 0.0f };
+        float   glue01[2]      { 1.0f, 1.0f };
+
+        // CPU load telemetry (deadline ratios; see CpuLoadStats)
+        float    cpuLoadP50    = 0.0f;
+        float    cpuLoadP99    = 0.0f;
+        float    cpuLoadMax    = 0.0f;
+        uint32_t cpuDeadlineMisses    = 0u;
+        uint32_t cpuAssistActivations = 0u;
+        bool     cpuAssistActive      = false;
+        uint8_t  cpuOverloadLevel       = 0u;
+        uint32_t cpuOverloadTransitions = 0u;
+
+        uint64_t frameCounter  = 0; // monotonic debug-only counter
+    };
+
+    // Meter readout (consumer side): a snapshot converted to dB and clamped for display.
+    struct MeterReadout final
     {
         double   inPeakDb[2]   { 0.0, 0.0 };
         double   outPeakDb[2]  { 0.0, 0.0 };
@@ -161,35 +364,43 @@ private:
         float   clamp01[2]     { 0.0f, 0.0f };
         float   glue01[2]      { 1.0f, 1.0f };
 
-        uint64_t frameCounter  = 0; // monotonic debug-only counter
+        float    cpuLoadP50    = 0.0f;
+        float    cpuLoadP99    = 0.0f;
+        float    cpuLoadMax    = 0.0f;
+        uint32_t cpuDeadlineMisses    = 0u;
+        uint32_t cpuAssistActivations = 0u;
+        bool     cpuAssistActive      = false;
+        uint8_t  cpuOverloadLevel       = 0u;
+        uint32_t cpuOverloadTransitions = 0u;
+
+        uint64_t frameCounter  = 0;
     };
 
-    // Meter publication primitive (SPSC ring, lock-free; declarations only in this step).
-    // Producer: audio thread. Consumer: UI thread.
-    //
-    // Publication rules:
-    // - Audio thread writes at a fixed cadence (e.g., every 256 or 512 samples).
-    // - If ring is full, new writes overwrite the oldest unread snapshot (consumer may miss frames).
-    // - UI reads opportunistically; missed frames are acceptable.
-    // - Snapshot is immutable once published (writer writes slot fully, then advances write index).
-    //
-    // Indices are modulo kMeterRingCapacity.
-    static constexpr uint32_t kMeterRingCapacity = 128; // fixed, no allocations
-    std::array<MeterSnapshot, (size_t) kMeterRingCapacity> meterRing {};
-
-    // writeIndex: next slot the producer will publish.
-    // readIndex:  next slot the consumer will read (advanced by consumer; may be forced forward on overwrite).
-    // meterSeq:   publication signal (incremented by producer AFTER a snapshot is fully written and published).
-    std::atomic<uint32_t> meterWriteIndex { 0u };
-    mutable std::atomic<uint32_t> meterReadIndex  { 0u };
-    std::atomic<uint32_t> meterSeq        { 0u }; // wraparound OK
-
-    // Consumer-side tracking for readMeters(): updated only by UI thread.
-    // Atomic is used defensively; keep usage contained to metering plumbing only.
-    mutable std::atomic<uint32_t> meterLastReadSeq { 0u };
+    static MeterReadout meterReadoutFrom (const MeterSnapshot& s) noexcept;
+
+    // Meter publication (compass::SeqlockRing, MeterTransport.h). Producer: audio thread (publishMeters).
+    // Readers: latest-value getters from any thread (readMeters, non-mutating) and one draining thread
+    // (drainMeters). Every slot read is validated by its seqlock stamp, so a snapshot is never observed
+    // half-written; a full ring overwrites the oldest unread snapshots. Mutable for the drain cursor only.
+    mutable compass::SeqlockRing<MeterSnapshot, (size_t) kMeterRingCapacity> meterRing;
+    uint64_t meterFrameCounter = 0u;
 
     void publishMeters (const MeterSnapshot& s) noexcept;
-    bool readMeters (MeterSnapshot& out) const noexcept;
+    bool readMeters (MeterReadout& out) const noexcept;
+
+    // Per-block meter stages (audio thread): loudness chunk accumulation, then cadence-driven publish.
+    template <typename SampleType>
+    void accumulateLoudness (const juce::AudioBuffer<SampleType>& buffer) noexcept;
+    void publishMetersAtCadence (int numSamples) noexcept;
+
+    // Block boundary (audio thread): latches consumer demand and the publish rate requested above.
+    void updateMeterDemand() noexcept;
+    void clearMeterHolds() noexcept;
+
+    std::atomic<int> meterConsumers { 0 };
+    std::atomic<int> meterRateHzRequested { 50 };
+    int  meterRateHzApplied = 50;
+    bool metersActive       = false; // audio-thread copy of (meterConsumers > 0)
 
     // Meter accumulators (double precision) — Step 3.1 (storage only; no meter math/publishing yet)
     double inPeakHold[2]  = { 0.0, 0.0 };
@@ -200,13 +411,14 @@ private:
     double outTpHold[2]   = { 0.0, 0.0 };
     double grHoldDb[2]    = { 0.0, 0.0 }; // attenuation magnitude in dB (0..+)
 
-    // Meter publish timing (members) — configured/used in later steps
+    // Meter publish timing: publish period follows meterRateHzApplied; loudness chunks stay at kLufsHz.
     int    meterPublishSamples = 0;
+    int    lufsChunkSamples    = 0;
     int    meterCountdown      = 0;
     double meterDt             = 0.0;
 
     // Loudness state (Phase 11): deterministic, bounded, allocation-free.
-    // Short-term is a fixed 3.0 s window implemented as 150 chunks at the meter cadence (~50 Hz).
+    // Short-term is a fixed 3.0 s window implemented as 150 chunks of lufsChunkSamples (kLufsHz).
     // Integrated is a running mean-square accumulator.
     static constexpr int kLufsHz          = 50;
     static constexpr int kLufsShortSec    = 3;
@@ -226,12 +438,21 @@ private:
     // Gate-3 deterministic state model:
     void reset (double sampleRate, int maxBlock, int channels) noexcept;
 
+    // Transport stop/start and realtime<->offline edges: reset() + ceiling envelope + oversampling latch.
+    void resetAtTransportBoundary() noexcept;
+
     // Oversampling + True Peak (Gate-4):
     // - FIR polyphase only (linear-phase reconstruction)
     // - Oversampling is prebuilt in prepareToPlay (no allocations in audio thread)
-    // - Active oversampling selection changes only on transport stop/start edge
+    // - Selection latches on transport stop/start / nonrealtime edges; realtime tier changes in between
+    //   go through the live switch (beginOsSwitch / processOsSwitchShadow), never a hard swap
     void prepareOversampling (int channels, int maxBlock);
+    void prepareOfflineOversampling (int channels, int maxBlock); // message thread / prepareToPlay only
+    void releaseOfflineOversampling();
     void selectOversamplingAtBoundary (int osMinIndex) noexcept;
+    int  realtimeOsTierFor (int osMinIndex) const noexcept;
+    void beginOsSwitch (int tier) noexcept;
+    void processOsSwitchShadow (int numCh, int n, float ceilingLin) noexcept;
     void measureTruePeak (const juce::AudioBuffer<float>& buffer) noexcept;
 
     // Phase D: promoted helpers (no allocations, no virtual dispatch)
@@ -261,7 +482,13 @@ private:
     double expLookup (double x) const noexcept;     // returns exp(-x) using expNegTable
     double log10Lookup (double y) const noexcept;   // returns log10(y) using log10Table (indexing may use std::log10)
 
-    void processOneSample (float* const* chPtr,
+    // Shared engine for float and double hosts (SampleType = host buffer precision).
+    // The oversampled path always runs SampleType = float (juce::dsp::Oversampling<float>).
+    template <typename SampleType>
+    void processBlockInternal (juce::AudioBuffer<SampleType>& buffer);
+
+    template <typename SampleType>
+    void processOneSample (SampleType* const* chPtr,
                           int numCh,
                           int i,
                           double dt,
@@ -271,6 +498,19 @@ private:
                           double link01,
                           double& grDbNegMin) noexcept;
 
+    // Gain application + ceiling stage of processOneSample, using the last computed lastOutScalar.
+    // Overload level >= 2 runs it alone on the oversampled sub-samples between native-rate control updates.
+    template <typename SampleType>
+    void applyGainAndCeiling (SampleType* const* chPtr, int numCh, int i, double ceilingDb) noexcept;
+
+    // The stage itself (gain, ceiling envelope, softclip) on explicit envelope state: the active path passes
+    // the members below, the live-switch shadow its own copy at the target tier's coefficients. No metering.
+    template <typename SampleType>
+    static void gainAndCeilingStage (SampleType* const* chPtr, int numCh, int i, float gL, float gR,
+                                     double link01Smooth, float ceilingLin,
+                                     float (&envState)[2], float& envStateLinked, float aDown, float aUp,
+                                     std::array<float, 2>& ceilScalarOut) noexcept;
+
     // Gate-2 smoothing policy (declared now; configured in prepareToPlay/reset):
     // - Drive/Ceiling: sample-accurate linear ramps (SmoothedValue)
     // - Stereo Link / Adaptive Bias: smoothed (SmoothedValue)
@@ -295,12 +535,114 @@ private:
     // Offline/nonrealtime edge detection (transition triggers boundary semantics):
     bool lastNonRealtime = false;
 
-    // Oversampling (prebuilt instances; selected at transport-safe boundary only)
+    // Oversampling (prebuilt instances; latched at transport-safe boundaries, live-switched in between)
     static constexpr int kOsCount = 3; // 2x / 4x / 8x
+
+    // processBlock runs upsample / engine / downsample in tiles of this many native samples
+    // (8x tile = 2048 floats per channel: L1/L2-resident regardless of the host block size).
+    static constexpr int kOsTileSamples = 256;
     std::array<std::unique_ptr<juce::dsp::Oversampling<float>>, kOsCount> oversamplers;
     juce::dsp::Oversampling<float>* activeOversampler = nullptr;
     std::array<int, kOsCount> oversamplerLatencySamples { 0, 0, 0 };
-    int latchedOsMinIndex = 0; // 0=2x, 1=4x, 2=8x (latched only at boundary)
+    std::array<int, kOsCount> oversamplerUpLatencySamples { 0, 0, 0 }; // processSamplesUp only (measured at prepare)
+    int latchedOsMinIndex = 0; // 0=2x, 1=4x, 2=8x (boundary latch or completed live switch)
+
+    // Offline quality tier (nonrealtime renders only): 16x / 32x, built lazily off the audio thread.
+    // Published with offlineOversamplersReady (release) and consumed at the nonrealtime boundary (acquire).
+    static constexpr int kOsOfflineCount = 2; // 16x / 32x
+    std::array<std::unique_ptr<juce::dsp::Oversampling<float>>, kOsOfflineCount> offlineOversamplers;
+    std::array<int, kOsOfflineCount> offlineOversamplerLatencySamples { 0, 0 };
+    std::array<int, kOsOfflineCount> offlineOversamplerUpLatencySamples { 0, 0 };
+    std::atomic<bool> offlineOversamplersReady { false };
+
+    // Active tier: [0, kOsCount) realtime, kOsCount + i = offline tier i.
+    int activeOsTier = 0;
+
+    // Per-tier detector-rate coefficients (ceiling envelope; the guardrail measurement runs at the native rate).
+    // Computed off the audio thread (prepareOversampling / prepareOfflineOversampling); tier changes only copy.
+    struct OsTierCoeffs final
+    {
+        float  ceilA_down = 0.0f, ceilA_up = 0.0f;
+    };
+    std::array<OsTierCoeffs, (size_t) (kOsCount + kOsOfflineCount)> osTierCoeffs {};
+    OsTierCoeffs computeOsTierCoeffs (int osFactor) const noexcept;
+    void applyOsTierCoeffs (int tier) noexcept;
+
+    // Up-sampling latency in native samples (impulse probe; prepare only). Leaves the oversampler reset.
+    static int measureUpsamplerLatency (juce::dsp::Oversampling<float>& os, int channels);
+
+    // Integer wet-path delay (per channel, preallocated). Pads a realtime tier up to osRealtimeLatencySamples.
+    struct AlignDelay final
+    {
+        juce::AudioBuffer<float> ring;
+        int writePos = 0;
+        int delay    = 0;
+
+        void prepare (int channels, int delaySamples)
+        {
+            delay = juce::jmax (0, delaySamples);
+            ring.setSize (juce::jmax (1, channels), juce::jmax (1, delay), false, true, false);
+            reset();
+        }
+
+        void reset() noexcept
+        {
+            ring.clear();
+            writePos = 0;
+        }
+
+        void process (float* const* chPtr, int numCh, int n) noexcept
+        {
+            if (delay <= 0)
+                return;
+
+            const int nc = juce::jmin (numCh, ring.getNumChannels());
+            int w = writePos;
+            for (int c = 0; c < nc; ++c)
+            {
+                float* r = ring.getWritePointer (c);
+                float* x = chPtr[c];
+                w = writePos;
+                for (int i = 0; i < n; ++i)
+                {
+                    const float y = r[w];
+                    r[w] = x[i];
+                    x[i] = y;
+                    if (++w >= delay) w = 0;
+                }
+            }
+            writePos = w;
+        }
+    };
+
+    // Live oversampling switch (realtime only: Oversampling Min edits / overload level 3 mid-playback).
+    // Every realtime tier reports the deepest tier's latency (osRealtimeLatencySamples); shallower tiers are
+    // padded by osAlign so a switch never moves the reported latency and old/new wet paths stay aligned.
+    // The target tier runs as a shadow path (input upsampled by the target, the active path's per-native-sample
+    // gain applied through the same gain + ceiling stage, downsampled, aligned): first osSwitchWarmupSamples to
+    // flush its filters, then a linear osSwitchFadeSamples crossfade; the active tier is swapped when the fade ends.
+    std::array<AlignDelay, (size_t) kOsCount> osAlign;
+    int osRealtimeLatencySamples = 0;
+    int osSwitchTarget        = -1; // -1 = no switch in progress
+    int osSwitchPos           = 0;  // native samples since the switch began
+    int osSwitchWarmupSamples = 0;
+    int osSwitchFadeSamples   = 1;
+    juce::AudioBuffer<float> osShadowBuffer; // native-rate input copy, then shadow wet (ch x maxBlock)
+    juce::AudioBuffer<float> osShadowGain;   // active path's deepest gain per native sample (2 x maxBlock)
+    float osShadowCeilState[2]    = { 1.0f, 1.0f }; // shadow ceiling envelope (seeded from the active path)
+    float osShadowCeilStateLinked = 1.0f;
+    std::array<float, 2> osShadowCeilScalar { 1.0f, 1.0f };
+
+    // Latency-matched dry path for the bypass crossfade (input tile delayed by the reported latency).
+    // Realtime tiers share osRealtimeLatencySamples; each offline tier has its own delay, prepared with it.
+    AlignDelay bypassDry;
+    std::array<AlignDelay, (size_t) kOsOfflineCount> bypassDryOffline;
+    juce::AudioBuffer<float> bypassDryBuffer; // native-rate input copy, then delayed dry (ch x tile)
+
+    AlignDelay& bypassDryFor (int tier) noexcept
+    {
+        return (tier < kOsCount ? bypassDry : bypassDryOffline[(size_t) juce::jlimit (0, kOsOfflineCount - 1, tier - kOsCount)]);
+    }
 
     // Control-domain true peak (linear)
     double truePeakLin = 0.0;
@@ -381,6 +723,15 @@ private:
     // Output scalar continuity (tiny, deterministic) — prevents micro-steps reaching the output
     std::array<float, 2> lastOutScalar { 1.0f, 1.0f };
 
+    // Ceiling envelope gain applied by the last applyGainAndCeiling call (per channel; 1 = no ceiling reduction)
+    std::array<float, 2> lastCeilScalar { 1.0f, 1.0f };
+
+    // Offline gain envelope capture (caller-owned; nullptr = disabled)
+    float* gainCaptureL = nullptr;
+    float* gainCaptureR = nullptr;
+    int    gainCaptureCapacity = 0;
+    int    gainCaptureCount    = 0;
+
     // Step 1.1 — Per-channel ceiling envelope state (2-channel accumulator contract)
     float ceilingGainState[2] = { 1.0f, 1.0f };
     float ceilingGainStateLinked = 1.0f;
@@ -396,9 +747,26 @@ private:
     // Phase 1.9 — Bypass crossfade (sample-accurate, no resets on bypass edges)
     float bypassMix = 1.0f; // 1=wet, 0=dry
 
+    // CPU-idle bypass: once the ramp reaches dry, the wet engine is suspended (state frozen, warm) and only
+    // bypassDry runs. Un-bypass resets the oversampler FIRs and runs a hidden pre-roll (wet computed,
+    // bypassMix held at 0) long enough to flush them and re-settle the envelopes before the crossfade back.
+    bool bypassSuspended = false;
+    int  bypassPreRollRemaining = 0;
+    int  bypassSettleSamples    = 0; // envelope part of the pre-roll (20 ms)
+
     // Phase 1.9 — Silence-horizon bounded memory (per-channel sample counter)
     std::array<int, 2> silenceCountSamples { 0, 0 };
 
+    // Linked fast path (processOneSample): engaged per sample while the link smoother sits at 1 (stereo_link ON,
+    // settled) and linkedChainsIdentical() holds, e.g. mono material on a stereo bus.
+    static constexpr double kLinkedFastPathMinLink = 1.0 - 1.0e-9;
+    bool linkedFastPathEnabled = true;
+    bool oversamplingPathEnabled = true;
+    bool linkedChainsIdentical (double s0, double s1) const noexcept;
+
+    // Phase 12 stage profiling (per instance; written by the audio thread only)
+    compass::StageCounters stageCounters;
+
     // Phase 1.6 — Stereo link transition smoothing (7 ms one-pole on control only)
     double lastLink01Smoothed = 1.0;
 
@@ -410,12 +778,52 @@ private:
     // Tiny GR floor + hysteresis memory (per-channel) to prevent threshold chatter (observational behavior unchanged)
     std::array<double, 2> lastAttnTargetDb { 0.0, 0.0 };
 
-    // CPU overload behavior: temporarily disable non-essential measurement extras (never changes user settings)
-    int overloadAssistBlocks = 0;
+    // CPU overload behavior: graded degradation scheduler (never changes user settings).
+    // Level 1: guardrail HF measurement held (last energy reused).
+    // Level 2: + detector/envelope/guardrail control at native rate; gain + ceiling stay at the OS rate.
+    // Level 3: + one oversampling factor lower (applied at the next oversampling switch point).
+    // Step down one level when a block exceeds kOverloadDownRatio of its deadline (at most once per
+    // kOverloadHoldBlocks); step up one level after kOverloadCalmBlocks consecutive blocks below kOverloadUpRatio.
+    // Block counts are timed blocks (housekeeping cadence: at least kHousekeepingSamples apart).
+    // Realtime only: nonrealtime renders pin level 0 (offline output never depends on machine speed).
+    static constexpr int    kOverloadMaxLevel   = 3;
+    static constexpr double kOverloadDownRatio  = 0.85;
+    static constexpr double kOverloadUpRatio    = 0.50;
+    static constexpr int    kOverloadHoldBlocks = 64;
+    static constexpr int    kOverloadCalmBlocks = 256;
+    int      overloadLevel       = 0;
+    int      overloadHoldBlocks  = 0;
+    int      overloadCalmBlocks  = 0;
+    uint32_t overloadTransitions = 0u;
+    double   overloadLoadOverride = -1.0; // setOverloadLoadOverride (tests only)
+
+    void resetOverloadScheduler() noexcept;
+    bool stepOverloadScheduler (double deadlineRatio, bool realtime) noexcept; // true on a 0 -> 1 engagement
+
+    // CPU load histogram (audio thread only; fixed-size, no allocations, summarized into MeterSnapshot).
+    // Bins cover deadline ratio [0, 2) in 1/16 steps; the last bin is open-ended.
+    // When the total reaches kCpuHistDecayAt all bins are halved (recent-window bias) and the window max restarts.
+    static constexpr int      kCpuHistBins        = 32;
+    static constexpr double   kCpuHistBinsPerUnit = 16.0;
+    static constexpr uint32_t kCpuHistDecayAt     = 4096u;
+    std::array<uint32_t, (size_t) kCpuHistBins> cpuHist {};
+    uint32_t cpuHistTotal         = 0u;
+    double   cpuRatioMaxWindow    = 0.0;
+    uint32_t cpuDeadlineMisses    = 0u;
+    uint32_t cpuAssistActivations = 0u;
+
+    void resetCpuLoadTelemetry() noexcept;
+    void recordBlockLoad (double deadlineRatio, bool assistEngaged) noexcept;
+    double cpuHistPercentile (double q) const noexcept;
 
     // NaN/Inf containment latch (release): if tripped, block output is forced safe and internal state resets
     bool badMathThisBlock = false;
 
+    // Anomaly flight recorder: processOneSample fills flightProbe (plain stores), processBlock pushes one
+    // frame per native sample and freezes the ring on badMathThisBlock / overload-assist engagement.
+    FlightRecorder flightRecorder;
+    FlightRecorder::Frame flightProbe {};
+
     // Envelope system (Micro + Macro, coupled)
     // Micro: critically damped 2nd-order model (no overshoot; ultra-fast capture; no ringing)
     // Discrete-time implementation: two cascaded one-pole followers (stable for any dt; no stiffness).
@@ -429,15 +837,42 @@ private:
     // - Crest factor proxy: 50 ms rectangular moving-average RMS^2 ring (SR_max=192 kHz => N_max=9600)
     // - Event density: continuous "event presence" accumulator (per-channel)
     static constexpr int kCrestRmsWinMaxN = 9600; // ceil(0.050 * 192000) = 9600
+    // Lazy reset: only the first rmsFilled[c] slots (written since the last reset) are live; stale slots read as 0,
+    // so a reset is O(1) (sum/index/fill count) instead of clearing the ring on the audio thread.
     double rmsSqRing[2][kCrestRmsWinMaxN] {};
     double rmsSqSum[2] { 0.0, 0.0 };
     int    rmsWriteIdx[2] { 0, 0 };
+    int    rmsFilled[2] { 0, 0 };
     int    rmsWinN = 1; // runtime: ceil(0.050*sampleRate), clamped to [1, kCrestRmsWinMaxN]
     int    rmsSilenceCount[2] { 0, 0 };
     int    rmsSilenceResetN = 1; // runtime: ceil(0.100*sampleRate)
     bool   invalidConfig = false; // set true if sampleRate > 192000.0
     std::array<double, 2> eventDensityState  { 0.0, 0.0 };
 
+    // Native-rate 50 ms RMS level (dB) per slot, refreshed by measureNativeSample() for the crest statistic.
+    std::array<double, 2> crestRmsDb { -240.0, -240.0 };
+
+    // Native-rate measurement side pass (input meters, HF guardrail energy, crest RMS window): once per native
+    // sample, before processOneSample() runs that sample's (oversampled) sub-samples.
+    template <typename SampleType>
+    void measureNativeSample (const SampleType* const* chPtr, int numCh, int i) noexcept;
+
+    // Output peak/RMS meter holds, once per native sample of the wet signal (after the downsampler on the
+    // oversampled path), so crestPostDb uses the same window length as crestPreDb.
+    template <typename SampleType>
+    void measureNativeOutputSample (const SampleType* const* chPtr, int numCh, int i) noexcept;
+
+    void resetCrestRmsWindows() noexcept
+    {
+        for (int c = 0; c < 2; ++c)
+        {
+            rmsSqSum[c] = 0.0;
+            rmsWriteIdx[c] = 0;
+            rmsFilled[c] = 0;
+            rmsSilenceCount[c] = 0;
+        }
+    }
+
     // Spectral Guardrails (measurement-only; broadband application)
     // Parallel measurement path:
     // - frequency-selective measurement allowed
@@ -448,6 +883,7 @@ private:
     std::array<double, 2> guardTotE    { 0.0, 0.0 }; // total energy EMA
     std::array<double, 2> guardHiE     { 0.0, 0.0 }; // high-band energy EMA
     double guardNb0 = 0.0, guardNb1 = 0.0, guardNb2 = 0.0, guardNa1 = 0.0, guardNa2 = 0.0;
+    double guardHfAlpha = 0.0, guardAccAlpha = 0.0; // 5 ms / 20 ms one-pole coefficients at the native step
 
     // Guardrail measurement compensation (Phase 1.7 Priority 4): 1st-order low-shelf (+3 dB @ 200 Hz), measurement path only
     double lowShelfB0 = 1.0, lowShelfB1 = 0.0, lowShelfA1 = 0.0; // identity defaults until boundary compute
@@ -461,5 +897,68 @@ private:
 
     std::unique_ptr<APVTS> apvts;
 
+    // Parameter atomics resolved once in the constructor (no string-keyed lookups on the audio thread).
+    struct ParamPtrs final
+    {
+        std::atomic<float>* drive               = nullptr;
+        std::atomic<float>* ceiling             = nullptr;
+        std::atomic<float>* adaptiveBias        = nullptr;
+        std::atomic<float>* stereoLink          = nullptr;
+        std::atomic<float>* oversamplingMin     = nullptr;
+        std::atomic<float>* oversamplingOffline = nullptr;
+        std::atomic<float>* trim                = nullptr;
+        std::atomic<float>* bypass              = nullptr;
+    };
+    ParamPtrs params;
+
+    // Small-block prologue: carried-state scan and block timing (telemetry, overload scheduler) run once per
+    // kHousekeepingSamples of audio (every callback for blocks >= 256; every 16th at 16 samples).
+    // The playhead is read on every callback so transport resets land on the edge block.
+    static constexpr int kHousekeepingSamples = 256;
+    int housekeepingCountdown = 0;
+
+    // Trim gain cache (std::pow only when the parameter moves) + 20 ms ramp in the dB domain (no zipper steps).
+    float trimDbCached  = 0.0f;
+    float trimLinCached = 1.0f;
+    juce::SmoothedValue<float, juce::ValueSmoothingTypes::Multiplicative> trimLinSmoothed;
+
+    // Parameter ramps: while any smoother is ramping, one tile of per-native-sample values is stepped into
+    // these buffers (steady smoothers take a vector fill); otherwise the tile reads the targets directly and
+    // no per-sample getNextValue() runs. Bit-identical to stepping the smoothers inline.
+    struct ParamFrame final
+    {
+        double driveDb   = 0.0;
+        double ceilingDb = 0.0;
+        double bias01    = 0.0;
+        double link01    = 0.0;
+    };
+
+    std::array<float, (size_t) kOsTileSamples> rampDriveDb {};
+    std::array<float, (size_t) kOsTileSamples> rampCeilingDb {};
+    std::array<float, (size_t) kOsTileSamples> rampBias01 {};
+    std::array<float, (size_t) kOsTileSamples> rampLink01 {};
+    std::array<float, (size_t) kOsTileSamples> rampTrimLin {};
+    bool paramsRamping = false;
+    ParamFrame paramSteady;
+
+    // Advances the four control smoothers by n <= kOsTileSamples native samples.
+    void prepareParamRamps (int n) noexcept;
+
+    ParamFrame paramAt (int i) const noexcept
+    {
+        if (! paramsRamping)
+            return paramSteady;
+
+        ParamFrame f;
+        f.driveDb   = (double) rampDriveDb[(size_t) i];
+        f.ceilingDb = (double) rampCeilingDb[(size_t) i];
+        f.bias01    = juce::jlimit (0.0, 1.0, (double) rampBias01[(size_t) i]);
+        f.link01    = juce::jlimit (0.0, 1.0, (double) rampLink01[(size_t) i]);
+        return f;
+    }
+
+    template <typename SampleType>
+    void applyTrim (juce::AudioBuffer<SampleType>& buffer) noexcept;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (CompassMasteringLimiterAudioProcessor)
 };
@@ -0,0 +1,140 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#if defined(COMPASS_ENABLE_STAGE_PROFILING) && (COMPASS_ENABLE_STAGE_PROFILING == 1)
+ #if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+  #if defined(_MSC_VER)
+   #include <intrin.h>
+  #else
+   #include <x86intrin.h>
+  #endif
+  #define COMPASS_STAGE_PROFILING_TSC 1
+ #else
+  #include <time.h>
+  #define COMPASS_STAGE_PROFILING_TSC 0
+ #endif
+#endif
+
+namespace compass
+{
+    // Phase 12 — Stage Profiling (BUILD-OPT-IN) (INSTRUMENTATION ONLY)
+    // Per-stage tick counters for the processing chain, one set per processor instance (no sharing between
+    // instances or threads). Audio-thread writes only; readers (bench/tests) sample after processing has
+    // stopped. With COMPASS_ENABLE_STAGE_PROFILING off (default) every hook below compiles to nothing and
+    // the counters stay at zero.
+    //
+    // Ticks are TSC cycles on x86 and CLOCK_MONOTONIC nanoseconds elsewhere (see stageTicksAreCycles()).
+
+    enum class Stage : std::uint8_t
+    {
+        Trim = 0,
+        Upsample,
+        Detector,
+        Hysteresis,
+        Envelope,
+        Guardrail,
+        Ceiling,
+        Downsample,
+        BypassMix,
+        Loudness,
+        MeterPublish,
+        Count
+    };
+
+    constexpr int kStageCount = (int) Stage::Count;
+
+    inline const char* stageName (Stage s) noexcept
+    {
+        switch (s)
+        {
+            case Stage::Trim:         return "trim";
+            case Stage::Upsample:     return "upsample";
+            case Stage::Detector:     return "detector";
+            case Stage::Hysteresis:   return "hysteresis";
+            case Stage::Envelope:     return "envelope";
+            case Stage::Guardrail:    return "guardrail";
+            case Stage::Ceiling:      return "ceiling";
+            case Stage::Downsample:   return "downsample";
+            case Stage::BypassMix:    return "bypass_mix";
+            case Stage::Loudness:     return "lufs";
+            case Stage::MeterPublish: return "meter_publish";
+            case Stage::Count:        break;
+        }
+        return "?";
+    }
+
+#if defined(COMPASS_ENABLE_STAGE_PROFILING) && (COMPASS_ENABLE_STAGE_PROFILING == 1)
+
+    constexpr bool kStageProfilingEnabled = true;
+
+    struct StageCounters final
+    {
+        std::array<std::uint64_t, (size_t) kStageCount> ticks {};
+        std::array<std::uint64_t, (size_t) kStageCount> hits  {};
+
+        void reset() noexcept
+        {
+            ticks.fill (0u);
+            hits.fill (0u);
+        }
+    };
+
+    inline std::uint64_t readStageTicks() noexcept
+    {
+       #if COMPASS_STAGE_PROFILING_TSC
+        return (std::uint64_t) __rdtsc();
+       #else
+        timespec ts {};
+        clock_gettime (CLOCK_MONOTONIC, &ts);
+        return (std::uint64_t) ts.tv_sec * 1000000000ull + (std::uint64_t) ts.tv_nsec;
+       #endif
+    }
+
+    constexpr bool stageTicksAreCycles() noexcept { return COMPASS_STAGE_PROFILING_TSC != 0; }
+
+    // Lap timer: each split() charges the ticks since the previous mark to one stage of `counters`.
+    // Lets straight-line code be carved into stages without introducing scopes around locals.
+    struct StageLap final
+    {
+        StageCounters& counters;
+        std::uint64_t mark = readStageTicks();
+
+        explicit StageLap (StageCounters& c) noexcept : counters (c) {}
+
+        void restart() noexcept { mark = readStageTicks(); }
+
+        void split (Stage s) noexcept
+        {
+            const std::uint64_t now = readStageTicks();
+            counters.ticks[(size_t) s] += (now - mark);
+            counters.hits[(size_t) s]  += 1u;
+            mark = now;
+        }
+    };
+
+    #define COMPASS_STAGE_LAP_BEGIN(lap, counters) ::compass::StageLap lap { counters }
+    #define COMPASS_STAGE_LAP_RESTART(lap)      lap.restart()
+    #define COMPASS_STAGE_LAP_SPLIT(lap, stage) lap.split (::compass::Stage::stage)
+
+#else
+
+    constexpr bool kStageProfilingEnabled = false;
+
+    struct StageCounters final
+    {
+        std::array<std::uint64_t, (size_t) kStageCount> ticks {};
+        std::array<std::uint64_t, (size_t) kStageCount> hits  {};
+
+        void reset() noexcept {}
+    };
+
+    constexpr bool stageTicksAreCycles() noexcept { return false; }
+
+    #define COMPASS_STAGE_LAP_BEGIN(lap, counters) ((void) 0)
+    #define COMPASS_STAGE_LAP_RESTART(lap)      ((void) 0)
+    #define COMPASS_STAGE_LAP_SPLIT(lap, stage) ((void) 0)
+
+#endif
+}
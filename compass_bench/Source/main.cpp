@@ -0,0 +1,697 @@
+#include <algorithm>
+#include <array>
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <juce_audio_processors/juce_audio_processors.h>
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <juce_dsp/juce_dsp.h>
+
+#include "PluginProcessor.h"
+#include "StageProfiler.h"
+
+//// [CML:BENCH] Stage-level microbenchmarks (SR x block x OS sweep, JSON report)
+//
+// compass_bench [--seconds S] [--sr 44100,48000,...] [--block 16,...,8192] [--os 2,4,8] [--out file.json]
+//               [--runs K] [--baseline base.json] [--max-slowdown-pct P] [--write-baseline base.json]
+//               [--missing-baseline fail|skip]
+//
+// Stages (timed separately, each on its own processor instance state):
+//   processBlock        full public callback (stress settings)
+//   transportResetBlock processBlock preceded by a transport-edge reset on every block (reset spike check;
+//                       expected within noise of processBlock)
+//   bypassedBlock       processBlock with host bypass engaged (engine suspended after the ramp: dry delay only)
+//   upsample/downsample active juce::dsp::Oversampling passes
+//   processOneSample    per-sample engine over the oversampled block (incl. the native-rate measurement pass)
+//   measureTruePeak     control-domain 4x FIR true-peak detector
+//   lufsAccumulate      loudness chunk accumulation
+//   meterPublish        cadence-driven meter snapshot publish (consumer attached)
+//
+// Reported per stage: ns per native sample and x-realtime. instancesPerCore = floor(processBlock x-realtime).
+// blockScaling: processBlock ns/sample at the smallest vs. largest block per (SR, OS) — small-block overhead check.
+//
+// Instrumented builds (-DCOMPASS_ENABLE_STAGE_PROFILING=ON) additionally report "stageProfile": the in-chain
+// counters from StageProfiler.h collected during the processBlock pass (ticks per native sample per stage;
+// median across --runs, like the timed stages).
+//
+// Regression gate: each configuration runs K times; nsPerSample is the median and madNsPerSample the median
+// absolute deviation. With --baseline, a stage regresses when
+//   current > baseline * (1 + P/100) + kGateMadK * 1.4826 * max(madCurrent, madBaseline)
+// and the process exits non-zero. Baseline files are plain compass_bench reports (--write-baseline).
+// --missing-baseline skip turns an absent baseline file into a SKIP (exit 0) instead of a failure.
+
+struct CompassBenchAccess
+{
+    using Proc = CompassMasteringLimiterAudioProcessor;
+
+    static juce::dsp::Oversampling<float>* activeOversampler (Proc& p) noexcept { return p.activeOversampler; }
+    static constexpr int osTileSamples = Proc::kOsTileSamples;
+
+    static void processOneSample (Proc& p, float* const* ch, int numCh, int i, double dt, double& grDbNegMin) noexcept
+    {
+        p.processOneSample (ch, numCh, i, dt, 20.0, -0.3, 1.0, 1.0, grDbNegMin);
+    }
+
+    static void measureNativeSample (Proc& p, const float* const* ch, int numCh, int i) noexcept
+    {
+        p.measureNativeSample (ch, numCh, i);
+    }
+
+    static void measureTruePeak (Proc& p, const juce::AudioBuffer<float>& b) noexcept { p.measureTruePeak (b); }
+    static void accumulateLoudness (Proc& p, const juce::AudioBuffer<float>& b) noexcept { p.accumulateLoudness (b); }
+    static void publishMetersAtCadence (Proc& p, int numSamples) noexcept { p.publishMetersAtCadence (numSamples); }
+    static void updateMeterDemand (Proc& p) noexcept { p.updateMeterDemand(); }
+    static void resetAtTransportBoundary (Proc& p) noexcept { p.resetAtTransportBoundary(); }
+};
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    constexpr int kWarmupBlocks = 16;
+
+    // Gate noise model: MAD scaled to sigma (1.4826) and widened by kGateMadK before the percentage budget applies.
+    constexpr double kGateMadK = 3.0;
+    constexpr double kMadToSigma = 1.4826;
+
+    struct StageResult
+    {
+        const char* name = "";
+        double nsPerSample = 0.0;
+        double xRealtime   = 0.0;
+        double madNsPerSample = 0.0;
+    };
+
+    struct ConfigResult
+    {
+        double sampleRate = 0.0;
+        int    blockSize  = 0;
+        int    osFactor   = 0;
+        int    latencySamples = 0;
+        std::vector<StageResult> stages;
+        int    instancesPerCore = 0;
+
+        std::array<double, (size_t) compass::kStageCount>        profTicksPerSample {};
+        std::array<std::uint64_t, (size_t) compass::kStageCount> profHits {};
+    };
+
+    template <typename T>
+    std::vector<T> parseList (const std::string& s)
+    {
+        std::vector<T> out;
+        std::stringstream ss (s);
+        std::string tok;
+        while (std::getline (ss, tok, ','))
+            if (! tok.empty())
+                out.push_back ((T) std::stod (tok));
+        return out;
+    }
+
+    bool argValue (int argc, char** argv, const char* name, std::string& out)
+    {
+        for (int i = 1; i + 1 < argc; ++i)
+        {
+            if (std::string (argv[i]) == name)
+            {
+                out = argv[i + 1];
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void setParamRaw (CompassMasteringLimiterAudioProcessor& proc, const char* id, float v) noexcept
+    {
+        auto* p = proc.getAPVTS().getRawParameterValue (id);
+        if (p != nullptr) p->store (v, std::memory_order_relaxed);
+    }
+
+    int osIndexForFactor (int factor) noexcept
+    {
+        return (factor >= 8 ? 2 : (factor >= 4 ? 1 : 0));
+    }
+
+    // Deterministic stress input: full-scale tone + small LCG noise (same seed for every configuration).
+    void fillInput (juce::AudioBuffer<float>& b, double sr, double& phase, uint32_t& prng) noexcept
+    {
+        const double w = 2.0 * 3.14159265358979323846 * 1000.0 / sr;
+        for (int i = 0; i < b.getNumSamples(); ++i)
+        {
+            prng = prng * 1664525u + 1013904223u;
+            const float noise = 0.02f * ((float) ((prng >> 8) & 0x00FFFFFFu) / (float) 0x01000000u - 0.5f);
+            const float s = (float) std::sin (phase) * 0.999f + noise;
+            phase += w;
+            for (int ch = 0; ch < b.getNumChannels(); ++ch)
+                b.setSample (ch, i, s);
+        }
+    }
+
+    void prepareStress (CompassMasteringLimiterAudioProcessor& proc, double sr, int bs, int osIndex)
+    {
+        proc.setPlayConfigDetails (2, 2, sr, bs);
+        setParamRaw (proc, "drive", 20.0f);
+        setParamRaw (proc, "ceiling", -0.3f);
+        setParamRaw (proc, "trim", 0.0f);
+        setParamRaw (proc, "adaptive_bias", 1.0f);
+        setParamRaw (proc, "stereo_link", 1.0f);
+        setParamRaw (proc, "oversampling_min", (float) osIndex);
+        proc.prepareToPlay (sr, bs);
+    }
+
+    StageResult makeStage (const char* name, double totalNs, int64_t samples, double sr) noexcept
+    {
+        StageResult r;
+        r.name = name;
+        r.nsPerSample = (samples > 0 ? totalNs / (double) samples : 0.0);
+        const double audioSec = (double) samples / sr;
+        r.xRealtime = (totalNs > 0.0 ? audioSec / (totalNs * 1.0e-9) : 0.0);
+        return r;
+    }
+
+    double elapsedNs (Clock::time_point a, Clock::time_point b) noexcept
+    {
+        return (double) std::chrono::duration_cast<std::chrono::nanoseconds> (b - a).count();
+    }
+
+    ConfigResult runConfig (double sr, int bs, int osFactor, double seconds)
+    {
+        using Access = CompassBenchAccess;
+
+        ConfigResult cr;
+        cr.sampleRate = sr;
+        cr.blockSize  = bs;
+        cr.osFactor   = osFactor;
+
+        const int osIndex = osIndexForFactor (osFactor);
+        const int nBlocks = juce::jmax (8, (int) std::ceil (seconds * sr / (double) bs));
+        const int64_t measuredSamples = (int64_t) nBlocks * (int64_t) bs;
+
+        juce::AudioBuffer<float> in (2, bs);
+        juce::AudioBuffer<float> buf (2, bs);
+        juce::MidiBuffer midi;
+
+        // 1) processBlock (public callback).
+        {
+            CompassMasteringLimiterAudioProcessor proc;
+            prepareStress (proc, sr, bs, osIndex);
+            cr.latencySamples = proc.getLatencySamples();
+
+            double phase = 0.0;
+            uint32_t prng = 0xC0FFEEu;
+            double ns = 0.0;
+
+            for (int k = 0; k < kWarmupBlocks + nBlocks; ++k)
+            {
+                if (k == kWarmupBlocks)
+                    proc.resetStageCounters();
+
+                fillInput (buf, sr, phase, prng);
+                const auto t0 = Clock::now();
+                proc.processBlock (buf, midi);
+                const auto t1 = Clock::now();
+                if (k >= kWarmupBlocks)
+                    ns += elapsedNs (t0, t1);
+            }
+
+            const auto& prof = proc.getStageCounters();
+            for (int s = 0; s < compass::kStageCount; ++s)
+            {
+                cr.profTicksPerSample[(size_t) s] = (double) prof.ticks[(size_t) s] / (double) measuredSamples;
+                cr.profHits[(size_t) s] = prof.hits[(size_t) s];
+            }
+
+            cr.stages.push_back (makeStage ("processBlock", ns, measuredSamples, sr));
+            cr.instancesPerCore = (int) std::floor (cr.stages.back().xRealtime);
+            proc.releaseResources();
+        }
+
+        // 1b) processBlock with a transport-edge reset in front of every block (same input stream).
+        {
+            CompassMasteringLimiterAudioProcessor proc;
+            prepareStress (proc, sr, bs, osIndex);
+
+            double phase = 0.0;
+            uint32_t prng = 0xC0FFEEu;
+            double ns = 0.0;
+
+            for (int k = 0; k < kWarmupBlocks + nBlocks; ++k)
+            {
+                fillInput (buf, sr, phase, prng);
+                const auto t0 = Clock::now();
+                Access::resetAtTransportBoundary (proc);
+                proc.processBlock (buf, midi);
+                const auto t1 = Clock::now();
+                if (k >= kWarmupBlocks)
+                    ns += elapsedNs (t0, t1);
+            }
+
+            cr.stages.push_back (makeStage ("transportResetBlock", ns, measuredSamples, sr));
+            proc.releaseResources();
+        }
+
+        // 1c) processBlock while bypassed (the warm-up blocks cover the bypass ramp; measured blocks are suspended).
+        {
+            CompassMasteringLimiterAudioProcessor proc;
+            setParamRaw (proc, "bypass", 1.0f);
+            prepareStress (proc, sr, bs, osIndex);
+
+            double phase = 0.0;
+            uint32_t prng = 0xC0FFEEu;
+            double ns = 0.0;
+
+            for (int k = 0; k < kWarmupBlocks + nBlocks; ++k)
+            {
+                fillInput (buf, sr, phase, prng);
+                const auto t0 = Clock::now();
+                proc.processBlock (buf, midi);
+                const auto t1 = Clock::now();
+                if (k >= kWarmupBlocks)
+                    ns += elapsedNs (t0, t1);
+            }
+
+            cr.stages.push_back (makeStage ("bypassedBlock", ns, measuredSamples, sr));
+            proc.releaseResources();
+        }
+
+        // 2) Oversampler up/down passes + 3) processOneSample over the oversampled block.
+        {
+            CompassMasteringLimiterAudioProcessor proc;
+            prepareStress (proc, sr, bs, osIndex);
+
+            auto* os = Access::activeOversampler (proc);
+            if (os != nullptr)
+            {
+                const int factor = juce::jmax (1, (int) os->getOversamplingFactor());
+                const double dtOS = 1.0 / (sr * (double) factor);
+
+                double phase = 0.0;
+                uint32_t prng = 0xC0FFEEu;
+                double nsUp = 0.0, nsDown = 0.0, nsSample = 0.0;
+
+                for (int k = 0; k < kWarmupBlocks + nBlocks; ++k)
+                {
+                    fillInput (buf, sr, phase, prng);
+                    juce::dsp::AudioBlock<float> full (buf);
+
+                    // Same tiling as processBlock (oversamplers are prepared for one tile).
+                    for (int tile0 = 0; tile0 < bs; tile0 += Access::osTileSamples)
+                    {
+                        auto blk = full.getSubBlock ((size_t) tile0, (size_t) juce::jmin (Access::osTileSamples, bs - tile0));
+
+                        const auto t0 = Clock::now();
+                        auto up = os->processSamplesUp (blk);
+                        const auto t1 = Clock::now();
+
+                        std::array<float*, 2> chPtr { up.getChannelPointer (0), up.getChannelPointer (1) };
+                        const std::array<const float*, 2> nativePtr { blk.getChannelPointer (0), blk.getChannelPointer (1) };
+                        const int osN = (int) up.getNumSamples();
+                        double grDbNegMin = 0.0;
+                        for (int i = 0; i < osN; ++i)
+                        {
+                            // Native-rate measurement side pass once per native sample (as in processBlock).
+                            if (i % factor == 0)
+                                Access::measureNativeSample (proc, nativePtr.data(), 2, i / factor);
+                            Access::processOneSample (proc, chPtr.data(), 2, i, dtOS, grDbNegMin);
+                        }
+                        const auto t2 = Clock::now();
+
+                        os->processSamplesDown (blk);
+                        const auto t3 = Clock::now();
+
+                        if (k >= kWarmupBlocks)
+                        {
+                            nsUp     += elapsedNs (t0, t1);
+                            nsSample += elapsedNs (t1, t2);
+                            nsDown   += elapsedNs (t2, t3);
+                        }
+                    }
+                }
+
+                cr.stages.push_back (makeStage ("upsample", nsUp, measuredSamples, sr));
+                cr.stages.push_back (makeStage ("processOneSample", nsSample, measuredSamples, sr));
+                cr.stages.push_back (makeStage ("downsample", nsDown, measuredSamples, sr));
+            }
+
+            proc.releaseResources();
+        }
+
+        // 4) measureTruePeak, 5) LUFS accumulation, 6) meter publish.
+        // Publishing only runs with a consumer attached (editor open): attach one and latch the demand,
+        // otherwise meterPublish would time the early return.
+        {
+            CompassMasteringLimiterAudioProcessor proc;
+            prepareStress (proc, sr, bs, osIndex);
+            proc.attachMeterConsumer();
+            Access::updateMeterDemand (proc);
+
+            double phase = 0.0;
+            uint32_t prng = 0xC0FFEEu;
+            double nsTp = 0.0, nsLufs = 0.0, nsPub = 0.0;
+
+            for (int k = 0; k < kWarmupBlocks + nBlocks; ++k)
+            {
+                fillInput (in, sr, phase, prng);
+
+                const auto t0 = Clock::now();
+                Access::measureTruePeak (proc, in);
+                const auto t1 = Clock::now();
+                Access::accumulateLoudness (proc, in);
+                const auto t2 = Clock::now();
+                Access::publishMetersAtCadence (proc, bs);
+                const auto t3 = Clock::now();
+
+                if (k >= kWarmupBlocks)
+                {
+                    nsTp   += elapsedNs (t0, t1);
+                    nsLufs += elapsedNs (t1, t2);
+                    nsPub  += elapsedNs (t2, t3);
+                }
+            }
+
+            cr.stages.push_back (makeStage ("measureTruePeak", nsTp, measuredSamples, sr));
+            cr.stages.push_back (makeStage ("lufsAccumulate", nsLufs, measuredSamples, sr));
+            cr.stages.push_back (makeStage ("meterPublish", nsPub, measuredSamples, sr));
+            proc.detachMeterConsumer();
+            proc.releaseResources();
+        }
+
+        return cr;
+    }
+
+    double medianOf (std::vector<double> v)
+    {
+        if (v.empty())
+            return 0.0;
+
+        std::sort (v.begin(), v.end());
+        const size_t m = v.size() / 2;
+        return (v.size() % 2 == 1 ? v[m] : 0.5 * (v[m - 1] + v[m]));
+    }
+
+    // Median-of-K per stage (and its MAD). Stage order is identical across runs of one configuration.
+    ConfigResult aggregateRuns (const std::vector<ConfigResult>& runs)
+    {
+        ConfigResult agg = runs.front();
+
+        for (size_t s = 0; s < agg.stages.size(); ++s)
+        {
+            std::vector<double> ns, xr;
+            for (const auto& r : runs)
+            {
+                ns.push_back (r.stages[s].nsPerSample);
+                xr.push_back (r.stages[s].xRealtime);
+            }
+
+            const double med = medianOf (ns);
+            std::vector<double> dev;
+            for (double x : ns)
+                dev.push_back (std::abs (x - med));
+
+            agg.stages[s].nsPerSample    = med;
+            agg.stages[s].xRealtime      = medianOf (xr);
+            agg.stages[s].madNsPerSample = medianOf (dev);
+        }
+
+        if (! agg.stages.empty())
+            agg.instancesPerCore = (int) std::floor (agg.stages.front().xRealtime);
+
+        for (size_t s = 0; s < (size_t) compass::kStageCount; ++s)
+        {
+            std::vector<double> ticks, hits;
+            for (const auto& r : runs)
+            {
+                ticks.push_back (r.profTicksPerSample[s]);
+                hits.push_back ((double) r.profHits[s]);
+            }
+
+            agg.profTicksPerSample[s] = medianOf (ticks);
+            agg.profHits[s]           = (std::uint64_t) std::llround (medianOf (hits));
+        }
+
+        return agg;
+    }
+
+    double stageNsPerSample (const ConfigResult& cr, const char* name) noexcept
+    {
+        for (const auto& st : cr.stages)
+            if (std::string (st.name) == name)
+                return st.nsPerSample;
+        return 0.0;
+    }
+
+    // Per (sampleRate, oversampling): processBlock ns/sample at the smallest vs. the largest block measured.
+    // smallToLargeRatio near 1.0 = per-callback overhead amortized (flat per-sample cost across block sizes).
+    void writeBlockScaling (std::ostream& o, const std::vector<ConfigResult>& results)
+    {
+        std::vector<std::pair<double, int>> keys;
+        for (const auto& cr : results)
+            if (std::find (keys.begin(), keys.end(), std::make_pair (cr.sampleRate, cr.osFactor)) == keys.end())
+                keys.emplace_back (cr.sampleRate, cr.osFactor);
+
+        o << "  \"blockScaling\": [\n";
+        for (size_t k = 0; k < keys.size(); ++k)
+        {
+            const ConfigResult* smallest = nullptr;
+            const ConfigResult* largest  = nullptr;
+            for (const auto& cr : results)
+            {
+                if (cr.sampleRate != keys[k].first || cr.osFactor != keys[k].second)
+                    continue;
+                if (smallest == nullptr || cr.blockSize < smallest->blockSize) smallest = &cr;
+                if (largest  == nullptr || cr.blockSize > largest->blockSize)  largest  = &cr;
+            }
+
+            const double nsSmall = stageNsPerSample (*smallest, "processBlock");
+            const double nsLarge = stageNsPerSample (*largest,  "processBlock");
+
+            o << "    { \"sampleRate\": " << keys[k].first << ", \"oversampling\": " << keys[k].second
+              << ", \"smallBlock\": " << smallest->blockSize << ", \"largeBlock\": " << largest->blockSize
+              << ", \"smallNsPerSample\": " << nsSmall << ", \"largeNsPerSample\": " << nsLarge
+              << ", \"smallToLargeRatio\": " << (nsLarge > 0.0 ? nsSmall / nsLarge : 0.0) << " }"
+              << (k + 1 < keys.size() ? "," : "") << "\n";
+        }
+        o << "  ]\n";
+    }
+
+    void writeJson (std::ostream& o, const std::vector<ConfigResult>& results, double seconds, int runs)
+    {
+        o << std::setprecision (6);
+        o << "{\n";
+        o << "  \"tool\": \"compass_bench\",\n";
+        o << "  \"secondsPerConfig\": " << seconds << ",\n";
+        o << "  \"runs\": " << runs << ",\n";
+        if (compass::kStageProfilingEnabled)
+            o << "  \"stageProfileUnit\": \"" << (compass::stageTicksAreCycles() ? "cycles" : "ns") << "\",\n";
+        o << "  \"results\": [\n";
+
+        for (size_t r = 0; r < results.size(); ++r)
+        {
+            const auto& cr = results[r];
+            o << "    {\n";
+            o << "      \"sampleRate\": " << cr.sampleRate << ",\n";
+            o << "      \"blockSize\": " << cr.blockSize << ",\n";
+            o << "      \"oversampling\": " << cr.osFactor << ",\n";
+            o << "      \"latencySamples\": " << cr.latencySamples << ",\n";
+            o << "      \"instancesPerCore\": " << cr.instancesPerCore << ",\n";
+            o << "      \"stages\": {\n";
+
+            for (size_t s = 0; s < cr.stages.size(); ++s)
+            {
+                const auto& st = cr.stages[s];
+                o << "        \"" << st.name << "\": { \"nsPerSample\": " << st.nsPerSample
+                  << ", \"madNsPerSample\": " << st.madNsPerSample
+                  << ", \"xRealtime\": " << st.xRealtime << " }"
+                  << (s + 1 < cr.stages.size() ? "," : "") << "\n";
+            }
+
+            o << "      }" << (compass::kStageProfilingEnabled ? "," : "") << "\n";
+
+            if (compass::kStageProfilingEnabled)
+            {
+                o << "      \"stageProfile\": {\n";
+                for (int s = 0; s < compass::kStageCount; ++s)
+                {
+                    o << "        \"" << compass::stageName ((compass::Stage) s) << "\": { \"ticksPerSample\": "
+                      << cr.profTicksPerSample[(size_t) s] << ", \"hits\": " << cr.profHits[(size_t) s] << " }"
+                      << (s + 1 < compass::kStageCount ? "," : "") << "\n";
+                }
+                o << "      }\n";
+            }
+
+            o << "    }" << (r + 1 < results.size() ? "," : "") << "\n";
+        }
+
+        o << "  ],\n";
+        writeBlockScaling (o, results);
+        o << "}\n";
+    }
+
+    bool writeJsonFile (const std::string& path, const std::vector<ConfigResult>& results, double seconds, int runs)
+    {
+        std::ofstream f (path);
+        if (! f)
+        {
+            std::cerr << "compass_bench FAIL (open " << path << ")\n";
+            return false;
+        }
+        writeJson (f, results, seconds, runs);
+        return true;
+    }
+
+    // Returns the number of regressed stages, or -1 if the baseline cannot be read.
+    // Configurations/stages missing on either side are reported and skipped (not failures).
+    int compareAgainstBaseline (const std::vector<ConfigResult>& results, const std::string& path, double maxSlowdownPct)
+    {
+        const juce::File file (juce::File::getCurrentWorkingDirectory().getChildFile (juce::String (path)));
+        if (! file.existsAsFile())
+        {
+            std::cerr << "compass_bench GATE baseline missing: " << path << " (create one with --write-baseline)\n";
+            return -1;
+        }
+
+        const juce::var base = juce::JSON::parse (file);
+        const auto* baseResults = base["results"].getArray();
+        if (baseResults == nullptr)
+        {
+            std::cerr << "compass_bench GATE baseline unreadable: " << path << "\n";
+            return -1;
+        }
+
+        int regressions = 0;
+
+        for (const auto& cr : results)
+        {
+            const juce::var* match = nullptr;
+            for (const auto& b : *baseResults)
+            {
+                if ((double) b["sampleRate"] == cr.sampleRate
+                    && (int) b["blockSize"] == cr.blockSize
+                    && (int) b["oversampling"] == cr.osFactor)
+                {
+                    match = &b;
+                    break;
+                }
+            }
+
+            if (match == nullptr)
+            {
+                std::cerr << "compass_bench GATE skip sr=" << (int) cr.sampleRate << " block=" << cr.blockSize
+                          << " os=" << cr.osFactor << "x (not in baseline)\n";
+                continue;
+            }
+
+            const juce::var baseStages = (*match)["stages"];
+
+            for (const auto& st : cr.stages)
+            {
+                const juce::var bs = baseStages[st.name];
+                if (! bs.isObject())
+                    continue;
+
+                const double baseNs  = (double) bs["nsPerSample"];
+                const double baseMad = (double) bs["madNsPerSample"]; // absent in single-run baselines -> 0
+                if (! (baseNs > 0.0))
+                    continue;
+
+                const double noiseNs = kGateMadK * kMadToSigma * juce::jmax (baseMad, st.madNsPerSample);
+                const double limitNs = baseNs * (1.0 + maxSlowdownPct / 100.0) + noiseNs;
+                const double deltaPct = 100.0 * (st.nsPerSample - baseNs) / baseNs;
+                const bool regressed = (st.nsPerSample > limitNs);
+
+                if (regressed)
+                    ++regressions;
+
+                std::cerr << "compass_bench GATE " << (regressed ? "REGRESSION" : "ok")
+                          << " sr=" << (int) cr.sampleRate << " block=" << cr.blockSize << " os=" << cr.osFactor << "x"
+                          << " stage=" << st.name << " base=" << baseNs << " cur=" << st.nsPerSample
+                          << " limit=" << limitNs << " delta=" << deltaPct << "%\n";
+            }
+        }
+
+        return regressions;
+    }
+}
+
+int main (int argc, char** argv)
+{
+    juce::ScopedJuceInitialiser_GUI juceInit;
+
+    std::vector<double> sampleRates { 44100.0, 48000.0, 96000.0, 192000.0 };
+    std::vector<int>    blockSizes  { 16, 32, 64, 128, 256, 512, 1024, 2048, 4096, 8192 };
+    std::vector<int>    osFactors   { 2, 4, 8 };
+    double seconds = 1.0;
+    int runs = 1;
+    double maxSlowdownPct = 10.0;
+    std::string outPath, baselinePath, writeBaselinePath, missingBaseline = "fail";
+
+    std::string v;
+    if (argValue (argc, argv, "--sr", v))      sampleRates = parseList<double> (v);
+    if (argValue (argc, argv, "--block", v))   blockSizes  = parseList<int> (v);
+    if (argValue (argc, argv, "--os", v))      osFactors   = parseList<int> (v);
+    if (argValue (argc, argv, "--seconds", v)) seconds     = juce::jmax (0.01, std::stod (v));
+    if (argValue (argc, argv, "--runs", v))    runs        = juce::jlimit (1, 101, std::stoi (v));
+    if (argValue (argc, argv, "--max-slowdown-pct", v)) maxSlowdownPct = juce::jmax (0.0, std::stod (v));
+    argValue (argc, argv, "--out", outPath);
+    argValue (argc, argv, "--baseline", baselinePath);
+    argValue (argc, argv, "--write-baseline", writeBaselinePath);
+    argValue (argc, argv, "--missing-baseline", missingBaseline);
+
+    // Nothing to compare against: skip before spending the sweep.
+    if (! baselinePath.empty() && missingBaseline == "skip"
+        && ! juce::File::getCurrentWorkingDirectory().getChildFile (juce::String (baselinePath)).existsAsFile())
+    {
+        std::cerr << "compass_bench GATE SKIP (no baseline at " << baselinePath
+                  << "; record one on the gate machine with the compass_bench_baseline target)\n";
+        return 0;
+    }
+
+    std::vector<ConfigResult> results;
+    results.reserve (sampleRates.size() * blockSizes.size() * osFactors.size());
+
+    for (double sr : sampleRates)
+    {
+        for (int bs : blockSizes)
+        {
+            for (int os : osFactors)
+            {
+                std::cerr << "compass_bench sr=" << (int) sr << " block=" << bs << " os=" << os << "x runs=" << runs << "\n";
+
+                std::vector<ConfigResult> perRun;
+                for (int k = 0; k < runs; ++k)
+                    perRun.push_back (runConfig (sr, juce::jlimit (1, 65536, bs), os, seconds));
+
+                results.push_back (aggregateRuns (perRun));
+            }
+        }
+    }
+
+    if (outPath.empty())
+        writeJson (std::cout, results, seconds, runs);
+    else if (! writeJsonFile (outPath, results, seconds, runs))
+        return 1;
+
+    if (! writeBaselinePath.empty() && ! writeJsonFile (writeBaselinePath, results, seconds, runs))
+        return 1;
+
+    if (! baselinePath.empty())
+    {
+        const int regressions = compareAgainstBaseline (results, baselinePath, maxSlowdownPct);
+        if (regressions != 0)
+        {
+            std::cerr << "compass_bench FAIL (" << (regressions < 0 ? std::string ("baseline") : std::to_string (regressions) + " stage regression(s)") << ")\n";
+            return 1;
+        }
+        std::cerr << "compass_bench GATE PASS (max slowdown " << maxSlowdownPct << "%)\n";
+    }
+
+    return 0;
+}
@@ -0,0 +1,345 @@
+#include <iostream>
+#include <cmath>
+#include <cstdlib>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include <juce_audio_processors/juce_audio_processors.h>
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <juce_audio_formats/juce_audio_formats.h>
+
+#include "PluginProcessor.h"
+
+//// [CML:RENDER] Offline render + compute-once gain envelope (stem mastering)
+//
+// render <mix.wav> <out.wav> [--gain-out <file.cmlg>] [options]
+//     Runs the limiter offline on the mix. Optionally exports the final per-sample linear gain track
+//     (post link, guardrails and slew, times the ceiling envelope) aligned to the input timeline.
+//
+// apply <file.cmlg> <stem.wav> <out.wav> [--trim <dB>]
+//     Multiplies a stem by an exported gain track. No detector run; one vectorized multiply per channel.
+//     Pass the same --trim used for the mix render so stems see the same input gain.
+//
+// Gain file (.cmlg), little-endian:
+//     "CMLG" | int32 version | float64 sampleRate | int32 channels | int64 frames | float32 planar [channels][frames]
+//
+// The post-ceiling softclip is a waveshaper (no gain to export): stems see the ceiling envelope, not the knee.
+
+static constexpr int kGainFileVersion = 1;
+
+static void printUsage()
+{
+    std::cout << "usage:\n"
+                 "  compass_render render <mix.wav> <out.wav> [--gain-out <file.cmlg>]\n"
+                 "                 [--drive dB] [--ceiling dBTP] [--trim dB] [--bias 0|0.5|1] [--link 0|1]\n"
+                 "                 [--os 0|1|2] [--os-offline 0|1|2] [--block N]\n"
+                 "  compass_render apply <file.cmlg> <stem.wav> <out.wav> [--trim dB]\n";
+}
+
+static bool findOption (int argc, char** argv, int first, const char* name, juce::String& out)
+{
+    for (int i = first; i + 1 < argc; ++i)
+    {
+        if (juce::String (argv[i]) == name)
+        {
+            out = juce::String (argv[i + 1]);
+            return true;
+        }
+    }
+    return false;
+}
+
+static double optionDouble (int argc, char** argv, int first, const char* name, double defv)
+{
+    juce::String s;
+    return (findOption (argc, argv, first, name, s) ? s.getDoubleValue() : defv);
+}
+
+static void setParamRaw (CompassMasteringLimiterAudioProcessor& proc, const char* id, float v) noexcept
+{
+    auto* p = proc.getAPVTS().getRawParameterValue (id);
+    if (p != nullptr) p->store (v, std::memory_order_relaxed);
+}
+
+static bool readAudio (const juce::File& f, juce::AudioBuffer<float>& dst, double& sampleRate)
+{
+    juce::AudioFormatManager fm;
+    fm.registerBasicFormats();
+
+    std::unique_ptr<juce::AudioFormatReader> reader (fm.createReaderFor (f));
+    if (reader == nullptr || reader->lengthInSamples <= 0 || reader->numChannels <= 0)
+        return false;
+
+    const int numCh = (int) reader->numChannels;
+    const int len = (int) reader->lengthInSamples;
+    dst.setSize (numCh, len);
+    if (! reader->read (&dst, 0, len, 0, true, true))
+        return false;
+
+    sampleRate = reader->sampleRate;
+    return true;
+}
+
+static bool writeWav (const juce::File& f, const juce::AudioBuffer<float>& src, double sampleRate)
+{
+    f.deleteFile();
+    auto out = f.createOutputStream();
+    if (out == nullptr)
+        return false;
+
+    juce::WavAudioFormat wav;
+    std::unique_ptr<juce::AudioFormatWriter> writer (wav.createWriterFor (out.get(), sampleRate,
+                                                                          (unsigned int) src.getNumChannels(),
+                                                                          32, {}, 0));
+    if (writer == nullptr)
+        return false;
+
+    out.release(); // writer owns the stream now
+    return writer->writeFromAudioSampleBuffer (src, 0, src.getNumSamples());
+}
+
+static bool writeGainFile (const juce::File& f, const juce::AudioBuffer<float>& gain, double sampleRate)
+{
+    f.deleteFile();
+    juce::FileOutputStream out (f);
+    if (! out.openedOk())
+        return false;
+
+    out.write ("CMLG", 4);
+    out.writeInt (kGainFileVersion);
+    out.writeDouble (sampleRate);
+    out.writeInt (gain.getNumChannels());
+    out.writeInt64 ((juce::int64) gain.getNumSamples());
+
+    for (int ch = 0; ch < gain.getNumChannels(); ++ch)
+        for (int i = 0; i < gain.getNumSamples(); ++i)
+            out.writeFloat (gain.getSample (ch, i));
+
+    out.flush();
+    return out.getStatus().wasOk();
+}
+
+static bool readGainFile (const juce::File& f, juce::AudioBuffer<float>& gain, double& sampleRate)
+{
+    juce::FileInputStream in (f);
+    if (! in.openedOk())
+        return false;
+
+    constexpr juce::int64 kHeaderBytes = 4 + 4 + 8 + 4 + 8;
+
+    char magic[4] = {};
+    if (in.read (magic, 4) != 4 || std::memcmp (magic, "CMLG", 4) != 0)
+        return false;
+
+    if (in.readInt() != kGainFileVersion)
+        return false;
+
+    sampleRate = in.readDouble();
+    const int numCh = in.readInt();
+    const juce::int64 frames = in.readInt64();
+    if (numCh <= 0 || frames <= 0 || frames > (juce::int64) std::numeric_limits<int>::max())
+        return false;
+
+    if (in.getTotalLength() != kHeaderBytes + (juce::int64) numCh * frames * (juce::int64) sizeof (float))
+        return false;
+
+    gain.setSize (numCh, (int) frames);
+    for (int ch = 0; ch < numCh; ++ch)
+        for (int i = 0; i < (int) frames; ++i)
+            gain.setSample (ch, i, in.readFloat());
+
+    return true;
+}
+
+static int runRender (int argc, char** argv)
+{
+    if (argc < 4)
+    {
+        printUsage();
+        return 2;
+    }
+
+    const juce::File inFile  = juce::File::getCurrentWorkingDirectory().getChildFile (argv[2]);
+    const juce::File outFile = juce::File::getCurrentWorkingDirectory().getChildFile (argv[3]);
+
+    juce::AudioBuffer<float> mix;
+    double sr = 0.0;
+    if (! readAudio (inFile, mix, sr))
+    {
+        std::cout << "compass_render FAIL (read " << inFile.getFullPathName() << ")\n";
+        return 1;
+    }
+
+    const int blockSize = juce::jlimit (16, 8192, (int) optionDouble (argc, argv, 4, "--block", 512.0));
+    const int len = mix.getNumSamples();
+
+    CompassMasteringLimiterAudioProcessor proc;
+    proc.setPlayConfigDetails (2, 2, sr, blockSize);
+    proc.setNonRealtime (true);
+
+    // Params before prepare so the smoothers start on target (no ramp at t=0).
+    setParamRaw (proc, "drive",            (float) optionDouble (argc, argv, 4, "--drive", 0.0));
+    setParamRaw (proc, "ceiling",          (float) optionDouble (argc, argv, 4, "--ceiling", -0.3));
+    setParamRaw (proc, "trim",             (float) optionDouble (argc, argv, 4, "--trim", 0.0));
+    setParamRaw (proc, "adaptive_bias",    (float) optionDouble (argc, argv, 4, "--bias", 1.0));
+    setParamRaw (proc, "stereo_link",      (float) optionDouble (argc, argv, 4, "--link", 1.0));
+    setParamRaw (proc, "oversampling_min", (float) juce::jlimit (0.0, 2.0, optionDouble (argc, argv, 4, "--os", 0.0)));
+    setParamRaw (proc, "oversampling_offline", (float) juce::jlimit (0.0, 2.0, optionDouble (argc, argv, 4, "--os-offline", 0.0)));
+
+    proc.prepareToPlay (sr, blockSize);
+
+    const int latency = juce::jmax (0, proc.getLatencySamples());
+    const int total = len + latency; // pad with latency zeros so the tail is flushed
+
+    // Capture index (j + upLat) acts on input sample j: the up-sampling share of the latency, as reported
+    // by the processor (the total also covers down-sampling and realtime tier padding).
+    const int upLat = juce::jlimit (0, latency, proc.getGainCaptureLatencySamples());
+
+    juce::AudioBuffer<float> work (2, total);
+    work.clear();
+    for (int ch = 0; ch < 2; ++ch)
+        work.copyFrom (ch, 0, mix, juce::jmin (ch, mix.getNumChannels() - 1), 0, len);
+
+    juce::String gainOutPath;
+    const bool exportGain = findOption (argc, argv, 4, "--gain-out", gainOutPath);
+
+    juce::AudioBuffer<float> gainRaw;
+    if (exportGain)
+    {
+        gainRaw.setSize (2, total);
+        gainRaw.clear();
+        proc.setGainCaptureTarget (gainRaw.getWritePointer (0), gainRaw.getWritePointer (1), total);
+    }
+
+    juce::AudioBuffer<float> block (2, blockSize);
+    juce::MidiBuffer midi;
+
+    for (int pos = 0; pos < total; pos += blockSize)
+    {
+        const int n = juce::jmin (blockSize, total - pos);
+        block.setSize (2, n, false, false, true);
+        for (int ch = 0; ch < 2; ++ch)
+            block.copyFrom (ch, 0, work, ch, pos, n);
+
+        proc.processBlock (block, midi);
+
+        for (int ch = 0; ch < 2; ++ch)
+            work.copyFrom (ch, pos, block, ch, 0, n);
+    }
+
+    const int captured = proc.getGainCaptureCount();
+    proc.setGainCaptureTarget (nullptr, nullptr, 0);
+    proc.releaseResources();
+
+    // Latency-compensated output (same length as the input).
+    juce::AudioBuffer<float> out (2, len);
+    for (int ch = 0; ch < 2; ++ch)
+        out.copyFrom (ch, 0, work, ch, latency, len);
+
+    if (! writeWav (outFile, out, sr))
+    {
+        std::cout << "compass_render FAIL (write " << outFile.getFullPathName() << ")\n";
+        return 1;
+    }
+
+    if (exportGain)
+    {
+        if (captured < total)
+        {
+            std::cout << "compass_render FAIL (gain capture " << captured << "/" << total << ")\n";
+            return 1;
+        }
+
+        juce::AudioBuffer<float> gain (2, len);
+        for (int ch = 0; ch < 2; ++ch)
+            gain.copyFrom (ch, 0, gainRaw, ch, upLat, len);
+
+        const juce::File gainFile = juce::File::getCurrentWorkingDirectory().getChildFile (gainOutPath);
+        if (! writeGainFile (gainFile, gain, sr))
+        {
+            std::cout << "compass_render FAIL (write " << gainFile.getFullPathName() << ")\n";
+            return 1;
+        }
+    }
+
+    std::cout << "compass_render PASS (render sr=" << sr << " frames=" << len
+              << " latency=" << latency << (exportGain ? " gain=exported" : "") << ")\n";
+    return 0;
+}
+
+static int runApply (int argc, char** argv)
+{
+    if (argc < 5)
+    {
+        printUsage();
+        return 2;
+    }
+
+    const auto cwd = juce::File::getCurrentWorkingDirectory();
+    const juce::File gainFile = cwd.getChildFile (argv[2]);
+    const juce::File stemFile = cwd.getChildFile (argv[3]);
+    const juce::File outFile  = cwd.getChildFile (argv[4]);
+
+    juce::AudioBuffer<float> gain;
+    double gainSr = 0.0;
+    if (! readGainFile (gainFile, gain, gainSr))
+    {
+        std::cout << "compass_render FAIL (read " << gainFile.getFullPathName() << ")\n";
+        return 1;
+    }
+
+    juce::AudioBuffer<float> stem;
+    double stemSr = 0.0;
+    if (! readAudio (stemFile, stem, stemSr))
+    {
+        std::cout << "compass_render FAIL (read " << stemFile.getFullPathName() << ")\n";
+        return 1;
+    }
+
+    if (stemSr != gainSr)
+    {
+        std::cout << "compass_render FAIL (sample rate mismatch: stem " << stemSr << " gain " << gainSr << ")\n";
+        return 1;
+    }
+
+    const float trimLin = std::pow (10.0f, (float) optionDouble (argc, argv, 5, "--trim", 0.0) / 20.0f);
+
+    // Stems shorter than the track use its prefix; samples past the track end get the last gain value.
+    const int len = stem.getNumSamples();
+    const int nTrack = juce::jmin (len, gain.getNumSamples());
+    for (int ch = 0; ch < stem.getNumChannels(); ++ch)
+    {
+        const int gCh = juce::jmin (ch, gain.getNumChannels() - 1);
+        float* dst = stem.getWritePointer (ch);
+
+        juce::FloatVectorOperations::multiply (dst, gain.getReadPointer (gCh), nTrack);
+        if (nTrack < len)
+            juce::FloatVectorOperations::multiply (dst + nTrack, gain.getSample (gCh, gain.getNumSamples() - 1), len - nTrack);
+    }
+
+    if (trimLin != 1.0f)
+        stem.applyGain (trimLin);
+
+    if (! writeWav (outFile, stem, stemSr))
+    {
+        std::cout << "compass_render FAIL (write " << outFile.getFullPathName() << ")\n";
+        return 1;
+    }
+
+    std::cout << "compass_render PASS (apply frames=" << len << ")\n";
+    return 0;
+}
+
+int main (int argc, char** argv)
+{
+    juce::ScopedJuceInitialiser_GUI juceInit;
+
+    if (argc >= 2 && juce::String (argv[1]) == "render") return runRender (argc, argv);
+    if (argc >= 2 && juce::String (argv[1]) == "apply")  return runApply (argc, argv);
+
+    printUsage();
+    return 2;
+}
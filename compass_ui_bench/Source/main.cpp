@@ -0,0 +1,422 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <juce_audio_processors/juce_audio_processors.h>
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <juce_gui_basics/juce_gui_basics.h>
+
+#include "PluginProcessor.h"
+#include "PluginEditor.h"
+
+//// [CML:BENCH] Headless editor rendering (software Graphics into juce::Image; no window, no GPU)
+//
+// compass_ui_bench [--frames N] [--warmup W] [--scales 1,1.5,2] [--out file.json]
+//
+// Every stage renders into an offscreen software image of (bounds x scale) through a Graphics context scaled by
+// the same factor, so the editor's caches see the physical scale exactly as on a HiDPI display.
+//
+// Stages (per scale factor):
+//   editor          one display frame: meter refresh (drain + readouts) + paintEntireComponent of the editor
+//   grHistoryMeter  GRHistoryMeter at its editor bounds; one synthetic history point + GR value per frame
+//   tpMeter         StereoVerticalLedMeter (output TP) at its editor bounds; synthetic L/R levels per frame
+//   knob            drawRotarySlider for the Glue knob at its slider-layout bounds; position swept per frame
+//
+// Reported per stage: msPerFrame (mean), p50Ms, p99Ms over the timed frames, and coldMs — the first frame after
+// the caches were invalidated (what a resize or scale change costs). Full-frame paints are an upper bound: a live
+// editor repaints only the dirty rectangles.
+//
+// Editor-stage meter data comes from the real path: one display frame (60 Hz) of synthetic audio is processed
+// through the plugin before each frame, outside the timed region. Component stages are fed directly.
+
+struct CompassUiBenchAccess
+{
+    using Editor = CompassMasteringLimiterAudioProcessorEditor;
+
+    static void refresh (Editor& e) { e.onVBlank(); }
+
+    static GRHistoryMeter&         grMeter (Editor& e) noexcept    { return e.grMeter; }
+    static StereoVerticalLedMeter& outTpMeter (Editor& e) noexcept { return e.outTpMeter; }
+    static juce::Slider&           glueKnob (Editor& e) noexcept   { return e.drive; }
+
+    // resized() drops every size-bound cache; the next paint rebuilds them.
+    static void invalidateCaches (Editor& e)
+    {
+        e.resized();
+        e.grMeter.resized();
+        e.inTpMeter.resized();
+        e.outTpMeter.resized();
+    }
+};
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    constexpr double kSampleRate    = 48000.0;
+    constexpr int    kBlockSize     = 512;
+    constexpr double kDisplayHz     = 60.0;
+
+    struct StageResult
+    {
+        const char* name = "";
+        double msPerFrame = 0.0;
+        double p50Ms      = 0.0;
+        double p99Ms      = 0.0;
+        double coldMs     = 0.0;
+    };
+
+    struct ScaleResult
+    {
+        double scale = 1.0;
+        std::vector<StageResult> stages;
+    };
+
+    template <typename T>
+    std::vector<T> parseList (const std::string& s)
+    {
+        std::vector<T> out;
+        std::stringstream ss (s);
+        std::string tok;
+        while (std::getline (ss, tok, ','))
+            if (! tok.empty())
+                out.push_back ((T) std::stod (tok));
+        return out;
+    }
+
+    bool argValue (int argc, char** argv, const char* name, std::string& out)
+    {
+        for (int i = 1; i + 1 < argc; ++i)
+        {
+            if (std::string (argv[i]) == name)
+            {
+                out = argv[i + 1];
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void setParamRaw (CompassMasteringLimiterAudioProcessor& proc, const char* id, float v) noexcept
+    {
+        auto* p = proc.getAPVTS().getRawParameterValue (id);
+        if (p != nullptr) p->store (v, std::memory_order_relaxed);
+    }
+
+    double elapsedMs (Clock::time_point a, Clock::time_point b) noexcept
+    {
+        return (double) std::chrono::duration_cast<std::chrono::nanoseconds> (b - a).count() * 1.0e-6;
+    }
+
+    double percentileOf (std::vector<double> v, double q)
+    {
+        if (v.empty())
+            return 0.0;
+
+        std::sort (v.begin(), v.end());
+        const size_t idx = (size_t) juce::jlimit (0, (int) v.size() - 1, (int) std::ceil (q * (double) v.size()) - 1);
+        return v[idx];
+    }
+
+    // Frame 0 is the cold frame (prepare invalidates caches there), then `warmup` untimed frames, then `frames`.
+    template <typename PrepareFn, typename RenderFn>
+    StageResult timeStage (const char* name, int frames, int warmup, PrepareFn&& prepareFrame, RenderFn&& renderFrame)
+    {
+        std::vector<double> ms;
+        ms.reserve ((size_t) frames);
+
+        StageResult r;
+        r.name = name;
+
+        for (int k = 0; k < 1 + warmup + frames; ++k)
+        {
+            prepareFrame (k);
+
+            const auto t0 = Clock::now();
+            renderFrame();
+            const auto t1 = Clock::now();
+
+            const double dt = elapsedMs (t0, t1);
+            if (k == 0)
+                r.coldMs = dt;
+            else if (k > warmup)
+                ms.push_back (dt);
+        }
+
+        double sum = 0.0;
+        for (double v : ms)
+            sum += v;
+
+        r.msPerFrame = (ms.empty() ? 0.0 : sum / (double) ms.size());
+        r.p50Ms      = percentileOf (ms, 0.50);
+        r.p99Ms      = percentileOf (ms, 0.99);
+        return r;
+    }
+
+    juce::Image makeTarget (juce::Rectangle<int> bounds, double scale)
+    {
+        return juce::Image (juce::Image::ARGB,
+                            juce::jmax (1, (int) std::ceil ((double) bounds.getWidth()  * scale)),
+                            juce::jmax (1, (int) std::ceil ((double) bounds.getHeight() * scale)),
+                            true,
+                            juce::SoftwareImageType());
+    }
+
+    // Deterministic program material: 1 kHz tone under a slow level swell (GR and TP move every frame).
+    struct SyntheticAudio
+    {
+        double phase = 0.0;
+        double swellPhase = 0.0;
+        double owedSamples = 0.0;
+        juce::AudioBuffer<float> buf { 2, kBlockSize };
+        juce::MidiBuffer midi;
+
+        // Processes whole blocks until one display frame worth of audio has gone through the plugin.
+        void advanceOneFrame (CompassMasteringLimiterAudioProcessor& proc)
+        {
+            owedSamples += kSampleRate / kDisplayHz;
+
+            const double w     = 2.0 * juce::MathConstants<double>::pi * 1000.0 / kSampleRate;
+            const double wSwell = 2.0 * juce::MathConstants<double>::pi * 0.5 / kSampleRate;
+
+            while (owedSamples >= (double) kBlockSize)
+            {
+                for (int i = 0; i < kBlockSize; ++i)
+                {
+                    const float amp = 0.25f + 0.70f * (float) (0.5 + 0.5 * std::sin (swellPhase));
+                    const float s = amp * (float) std::sin (phase);
+                    phase += w;
+                    swellPhase += wSwell;
+                    buf.setSample (0, i, s);
+                    buf.setSample (1, i, s);
+                }
+
+                proc.processBlock (buf, midi);
+                owedSamples -= (double) kBlockSize;
+            }
+        }
+    };
+
+    ScaleResult runScale (CompassMasteringLimiterAudioProcessor& proc,
+                          CompassMasteringLimiterAudioProcessorEditor& ed,
+                          double scale, int frames, int warmup)
+    {
+        using Access = CompassUiBenchAccess;
+
+        ScaleResult sr;
+        sr.scale = scale;
+
+        const auto xform = juce::AffineTransform::scale ((float) scale);
+
+        // 1) Full editor frame.
+        {
+            auto img = makeTarget (ed.getLocalBounds(), scale);
+            SyntheticAudio audio;
+
+            sr.stages.push_back (timeStage ("editor", frames, warmup,
+                [&] (int k)
+                {
+                    if (k == 0)
+                        Access::invalidateCaches (ed);
+                    audio.advanceOneFrame (proc);
+                },
+                [&]
+                {
+                    Access::refresh (ed);
+                    juce::Graphics g (img);
+                    g.addTransform (xform);
+                    ed.paintEntireComponent (g, true);
+                }));
+        }
+
+        // 2) GR history meter (timeline scroll + cached LED strips).
+        {
+            auto& m = Access::grMeter (ed);
+            auto img = makeTarget (m.getLocalBounds(), scale);
+
+            sr.stages.push_back (timeStage ("grHistoryMeter", frames, warmup,
+                [&] (int k)
+                {
+                    if (k == 0)
+                        Access::invalidateCaches (ed);
+
+                    const float t = (float) k * 0.05f;
+                    GRHistoryMeter::HistoryPoint p;
+                    p.grDb        = 6.0f + 5.0f * std::sin (t);
+                    p.outTpDb     = -1.0f - 2.0f * (0.5f + 0.5f * std::sin (3.1f * t));
+                    p.lufsShortDb = -9.0f + 1.5f * std::sin (0.7f * t);
+
+                    m.pushHistory (&p, 1);
+                    m.pushValueDb (p.grDb);
+                    img.clear (img.getBounds());
+                },
+                [&]
+                {
+                    juce::Graphics g (img);
+                    g.addTransform (xform);
+                    m.paintEntireComponent (g, true);
+                }));
+        }
+
+        // 3) Stereo TP LED meter.
+        {
+            auto& m = Access::outTpMeter (ed);
+            auto img = makeTarget (m.getLocalBounds(), scale);
+
+            sr.stages.push_back (timeStage ("tpMeter", frames, warmup,
+                [&] (int k)
+                {
+                    if (k == 0)
+                        Access::invalidateCaches (ed);
+
+                    const float t = (float) k * 0.07f;
+                    m.pushValueDbLR (-30.0f + 28.0f * (0.5f + 0.5f * std::sin (t)),
+                                     -30.0f + 28.0f * (0.5f + 0.5f * std::sin (t + 0.8f)));
+                    img.clear (img.getBounds());
+                },
+                [&]
+                {
+                    juce::Graphics g (img);
+                    g.addTransform (xform);
+                    m.paintEntireComponent (g, true);
+                }));
+        }
+
+        // 4) Knob (cached body + live indicator), drawn through the slider's own look-and-feel.
+        {
+            auto& knob = Access::glueKnob (ed);
+            auto& lnf  = knob.getLookAndFeel();
+            const auto area = lnf.getSliderLayout (knob).sliderBounds;
+            const auto rp   = knob.getRotaryParameters();
+
+            auto img = makeTarget (knob.getLocalBounds(), scale);
+            float pos = 0.0f;
+
+            sr.stages.push_back (timeStage ("knob", frames, warmup,
+                [&] (int k)
+                {
+                    if (k == 0)
+                        Access::invalidateCaches (ed);
+
+                    pos = 0.5f + 0.5f * std::sin ((float) k * 0.05f);
+                    img.clear (img.getBounds());
+                },
+                [&]
+                {
+                    juce::Graphics g (img);
+                    g.addTransform (xform);
+                    lnf.drawRotarySlider (g, area.getX(), area.getY(), area.getWidth(), area.getHeight(),
+                                          pos, rp.startAngleRadians, rp.endAngleRadians, knob);
+                }));
+        }
+
+        return sr;
+    }
+
+    void writeJson (std::ostream& o, const std::vector<ScaleResult>& results, int frames, int warmup,
+                    juce::Rectangle<int> editorBounds)
+    {
+        o << std::setprecision (6);
+        o << "{\n";
+        o << "  \"tool\": \"compass_ui_bench\",\n";
+        o << "  \"frames\": " << frames << ",\n";
+        o << "  \"warmupFrames\": " << warmup << ",\n";
+        o << "  \"editorWidth\": " << editorBounds.getWidth() << ",\n";
+        o << "  \"editorHeight\": " << editorBounds.getHeight() << ",\n";
+        o << "  \"results\": [\n";
+
+        for (size_t r = 0; r < results.size(); ++r)
+        {
+            const auto& sr = results[r];
+            o << "    {\n";
+            o << "      \"scale\": " << sr.scale << ",\n";
+            o << "      \"stages\": {\n";
+
+            for (size_t s = 0; s < sr.stages.size(); ++s)
+            {
+                const auto& st = sr.stages[s];
+                o << "        \"" << st.name << "\": { \"msPerFrame\": " << st.msPerFrame
+                  << ", \"p50Ms\": " << st.p50Ms
+                  << ", \"p99Ms\": " << st.p99Ms
+                  << ", \"coldMs\": " << st.coldMs << " }"
+                  << (s + 1 < sr.stages.size() ? "," : "") << "\n";
+            }
+
+            o << "      }\n";
+            o << "    }" << (r + 1 < results.size() ? "," : "") << "\n";
+        }
+
+        o << "  ]\n";
+        o << "}\n";
+    }
+}
+
+int main (int argc, char** argv)
+{
+    juce::ScopedJuceInitialiser_GUI juceInit;
+
+    std::vector<double> scales { 1.0, 1.5, 2.0 };
+    int frames = 240;
+    int warmup = 30;
+    std::string outPath;
+
+    std::string v;
+    if (argValue (argc, argv, "--scales", v)) scales = parseList<double> (v);
+    if (argValue (argc, argv, "--frames", v)) frames = juce::jlimit (1, 100000, std::stoi (v));
+    if (argValue (argc, argv, "--warmup", v)) warmup = juce::jlimit (0, 100000, std::stoi (v));
+    argValue (argc, argv, "--out", outPath);
+
+    CompassMasteringLimiterAudioProcessor proc;
+    proc.setPlayConfigDetails (2, 2, kSampleRate, kBlockSize);
+    setParamRaw (proc, "drive", 12.0f);
+    setParamRaw (proc, "ceiling", -0.3f);
+    proc.prepareToPlay (kSampleRate, kBlockSize);
+
+    std::vector<ScaleResult> results;
+    juce::Rectangle<int> editorBounds;
+
+    {
+        // Never added to the desktop: no peer, no window, no vblank — the bench drives the refresh itself.
+        CompassMasteringLimiterAudioProcessorEditor ed (proc);
+        editorBounds = ed.getLocalBounds();
+
+        for (double s : scales)
+        {
+            const double scale = juce::jlimit (0.25, 4.0, s);
+            std::cerr << "compass_ui_bench scale=" << scale << " frames=" << frames << "\n";
+
+            results.push_back (runScale (proc, ed, scale, frames, warmup));
+
+            for (const auto& st : results.back().stages)
+                std::cerr << "  " << std::left << std::setw (16) << st.name << std::right << std::fixed << std::setprecision (3)
+                          << " mean " << st.msPerFrame << " ms  p99 " << st.p99Ms << " ms  cold " << st.coldMs << " ms\n";
+            std::cerr.unsetf (std::ios::floatfield);
+        }
+    }
+
+    proc.releaseResources();
+
+    if (outPath.empty())
+    {
+        writeJson (std::cout, results, frames, warmup, editorBounds);
+        return 0;
+    }
+
+    std::ofstream f (outPath);
+    if (! f)
+    {
+        std::cerr << "compass_ui_bench FAIL (open " << outPath << ")\n";
+        return 1;
+    }
+
+    writeJson (f, results, frames, warmup, editorBounds);
+    return 0;
+}
@@ -0,0 +1,525 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <juce_audio_processors/juce_audio_processors.h>
+#include <juce_audio_basics/juce_audio_basics.h>
+
+#include "PluginProcessor.h"
+
+//// [CML:GOLDEN] Bit-exact golden output corpus
+//
+// reference_golden                        self-check: every corpus item renders bit-identically twice
+//                                         (E005: determinism within one build, not a regression check)
+// reference_golden --write <dir>          render corpus, write manifest.json + reference renders (*.f32)
+// reference_golden --check <dir> [--mode exact|tolerance] [--max-ulp N] [--max-diff-db X]
+//
+// Corpus (deterministic, seeded LCG; seed recorded in the manifest, CML_TEST_SEED overrides on --write):
+//   tone          997 Hz sine, -1 dBFS
+//   pink          pink noise (Kellet filter), ~-12 dBFS RMS, decorrelated L/R
+//   drums         decaying noise bursts + low thumps, peaks near 0 dBFS
+//   clipped       hot mix hard-clipped at 0 dBFS (inter-sample overs)
+//   silence_gaps  tone bursts separated by digital silence (silence-horizon reset path)
+//
+// Render: nonrealtime, fixed SR/block, each item through every kRenderOs tier with fixed parameters.
+// exact:     FNV-1a 64 over the float32 output bits must match the manifest.
+// tolerance: per sample, ULP distance <= --max-ulp OR |diff| <= --max-diff-db (dBFS); maxima reported.
+// No recorded corpus ships with the tree: --write/--check are tooling for B008 until a manifest is committed.
+
+namespace
+{
+    constexpr double kSampleRate   = 48000.0;
+    constexpr int    kBlockSize    = 512;
+    constexpr double kItemSeconds  = 4.0;
+    constexpr int    kChannels     = 2;
+    constexpr uint32_t kDefaultSeed = 0xC0FFEEu;
+
+    constexpr int kRenderOs[] = { 0, 2 }; // oversampling_min index: 2x, 8x
+
+    constexpr int    kDefaultMaxUlp    = 64;
+    constexpr double kDefaultMaxDiffDb = -120.0;
+
+    constexpr double kTwoPi = 6.28318530717958647692;
+
+    struct Lcg
+    {
+        uint32_t s;
+        float next() noexcept // [-1, 1)
+        {
+            s = s * 1664525u + 1013904223u;
+            return 2.0f * ((float) ((s >> 8) & 0x00FFFFFFu) / (float) 0x01000000u) - 1.0f;
+        }
+    };
+
+    using Signal = juce::AudioBuffer<float>;
+
+    Signal makeTone (int n, uint32_t)
+    {
+        Signal b (kChannels, n);
+        const float a = (float) std::pow (10.0, -1.0 / 20.0);
+        for (int i = 0; i < n; ++i)
+        {
+            const float v = a * (float) std::sin (kTwoPi * 997.0 * (double) i / kSampleRate);
+            for (int c = 0; c < kChannels; ++c)
+                b.setSample (c, i, v);
+        }
+        return b;
+    }
+
+    Signal makePink (int n, uint32_t seed)
+    {
+        Signal b (kChannels, n);
+        for (int c = 0; c < kChannels; ++c)
+        {
+            Lcg rng { seed + 0x9E3779B9u * (uint32_t) (c + 1) };
+            double b0 = 0, b1 = 0, b2 = 0, b3 = 0, b4 = 0, b5 = 0, b6 = 0;
+            for (int i = 0; i < n; ++i)
+            {
+                const double w = (double) rng.next();
+                b0 = 0.99886 * b0 + w * 0.0555179;
+                b1 = 0.99332 * b1 + w * 0.0750759;
+                b2 = 0.96900 * b2 + w * 0.1538520;
+                b3 = 0.86650 * b3 + w * 0.3104856;
+                b4 = 0.55000 * b4 + w * 0.5329522;
+                b5 = -0.7616 * b5 - w * 0.0168980;
+                const double pink = b0 + b1 + b2 + b3 + b4 + b5 + b6 + w * 0.5362;
+                b6 = w * 0.115926;
+                b.setSample (c, i, (float) (pink * 0.11));
+            }
+        }
+        return b;
+    }
+
+    Signal makeDrums (int n, uint32_t seed)
+    {
+        Signal b (kChannels, n);
+        Lcg rng { seed ^ 0xD1CEu };
+        const int hitEvery = (int) (0.25 * kSampleRate);
+        for (int i = 0; i < n; ++i)
+        {
+            const int k = i % hitEvery;
+            const int hit = i / hitEvery;
+            const double t = (double) k / kSampleRate;
+            const double snap = std::exp (-t / 0.004) * (double) rng.next();
+            const double thump = (hit % 2 == 0) ? std::exp (-t / 0.060) * std::sin (kTwoPi * 55.0 * t) : 0.0;
+            const float v = (float) juce::jlimit (-0.995, 0.995, 0.6 * snap + 0.7 * thump);
+            b.setSample (0, i, v);
+            b.setSample (1, i, (float) (0.9 * v));
+        }
+        return b;
+    }
+
+    Signal makeClipped (int n, uint32_t seed)
+    {
+        Signal b (kChannels, n);
+        Lcg rng { seed ^ 0xC11Bu };
+        const double drive = std::pow (10.0, 12.0 / 20.0);
+        for (int i = 0; i < n; ++i)
+        {
+            const double t = (double) i / kSampleRate;
+            const double mix = 0.5 * std::sin (kTwoPi * 110.0 * t) + 0.3 * std::sin (kTwoPi * 3520.0 * t) + 0.1 * (double) rng.next();
+            const float v = (float) juce::jlimit (-1.0, 1.0, drive * mix);
+            b.setSample (0, i, v);
+            b.setSample (1, i, v);
+        }
+        return b;
+    }
+
+    Signal makeSilenceGaps (int n, uint32_t)
+    {
+        Signal b (kChannels, n);
+        b.clear();
+        const int period = (int) (1.25 * kSampleRate);
+        const int burst  = (int) (0.50 * kSampleRate);
+        for (int i = 0; i < n; ++i)
+        {
+            if ((i % period) >= burst)
+                continue;
+            const float v = 0.95f * (float) std::sin (kTwoPi * 440.0 * (double) i / kSampleRate);
+            for (int c = 0; c < kChannels; ++c)
+                b.setSample (c, i, v);
+        }
+        return b;
+    }
+
+    struct CorpusItem
+    {
+        const char* name;
+        Signal (*make) (int, uint32_t);
+    };
+
+    const CorpusItem kCorpus[] =
+    {
+        { "tone",         makeTone },
+        { "pink",         makePink },
+        { "drums",        makeDrums },
+        { "clipped",      makeClipped },
+        { "silence_gaps", makeSilenceGaps },
+    };
+
+    void setParamRaw (CompassMasteringLimiterAudioProcessor& proc, const char* id, float v) noexcept
+    {
+        auto* p = proc.getAPVTS().getRawParameterValue (id);
+        if (p != nullptr) p->store (v, std::memory_order_relaxed);
+    }
+
+    // Fresh processor per render (deterministic initial state), fixed parameters, nonrealtime (no assist).
+    Signal render (const Signal& in, int osIndex)
+    {
+        CompassMasteringLimiterAudioProcessor proc;
+        proc.setNonRealtime (true);
+        proc.setPlayConfigDetails (kChannels, kChannels, kSampleRate, kBlockSize);
+        setParamRaw (proc, "trim", 0.0f);
+        setParamRaw (proc, "drive", 12.0f);
+        setParamRaw (proc, "ceiling", -1.0f);
+        setParamRaw (proc, "adaptive_bias", 0.5f);
+        setParamRaw (proc, "stereo_link", 1.0f);
+        setParamRaw (proc, "oversampling_min", (float) osIndex);
+        setParamRaw (proc, "oversampling_offline", 0.0f);
+        proc.prepareToPlay (kSampleRate, kBlockSize);
+
+        const int n = in.getNumSamples();
+        Signal out (kChannels, n);
+        juce::AudioBuffer<float> block (kChannels, kBlockSize);
+        juce::MidiBuffer midi;
+
+        for (int pos = 0; pos < n; pos += kBlockSize)
+        {
+            const int len = juce::jmin (kBlockSize, n - pos);
+            block.setSize (kChannels, len, false, false, true);
+            for (int c = 0; c < kChannels; ++c)
+                block.copyFrom (c, 0, in, c, pos, len);
+
+            proc.processBlock (block, midi);
+
+            for (int c = 0; c < kChannels; ++c)
+                out.copyFrom (c, pos, block, c, 0, len);
+        }
+
+        proc.releaseResources();
+        return out;
+    }
+
+    uint64_t fnv1a64 (const Signal& b) noexcept
+    {
+        uint64_t h = 0xcbf29ce484222325ull;
+        for (int i = 0; i < b.getNumSamples(); ++i)
+        {
+            for (int c = 0; c < b.getNumChannels(); ++c)
+            {
+                const float v = b.getSample (c, i);
+                uint32_t bits = 0;
+                std::memcpy (&bits, &v, sizeof (bits));
+                for (int k = 0; k < 4; ++k)
+                {
+                    h ^= (uint64_t) ((bits >> (8 * k)) & 0xFFu);
+                    h *= 0x100000001b3ull;
+                }
+            }
+        }
+        return h;
+    }
+
+    std::string hex64 (uint64_t v)
+    {
+        std::ostringstream o;
+        o << std::hex << std::setw (16) << std::setfill ('0') << v;
+        return o.str();
+    }
+
+    std::string entryName (const char* item, int osIndex)
+    {
+        return std::string (item) + "__os" + std::to_string (1 << (osIndex + 1)) + "x";
+    }
+
+    // Interleaved little-endian float32 (reference render for tolerance mode).
+    bool writeF32 (const std::string& path, const Signal& b)
+    {
+        std::ofstream f (path, std::ios::binary);
+        if (! f) return false;
+        for (int i = 0; i < b.getNumSamples(); ++i)
+            for (int c = 0; c < b.getNumChannels(); ++c)
+            {
+                const float v = b.getSample (c, i);
+                f.write (reinterpret_cast<const char*> (&v), sizeof (v));
+            }
+        return (bool) f;
+    }
+
+    bool readF32 (const std::string& path, int numCh, Signal& out)
+    {
+        std::ifstream f (path, std::ios::binary | std::ios::ate);
+        if (! f) return false;
+        const std::streamoff bytes = f.tellg();
+        const int frames = (int) (bytes / (std::streamoff) (sizeof (float) * (size_t) numCh));
+        f.seekg (0);
+        out.setSize (numCh, frames);
+        for (int i = 0; i < frames; ++i)
+            for (int c = 0; c < numCh; ++c)
+            {
+                float v = 0.0f;
+                f.read (reinterpret_cast<char*> (&v), sizeof (v));
+                out.setSample (c, i, v);
+            }
+        return (bool) f;
+    }
+
+    // ULP distance on the monotonic integer mapping of IEEE-754 float (sign-magnitude -> two's complement order).
+    uint64_t ulpDistance (float a, float b) noexcept
+    {
+        if (std::isnan (a) || std::isnan (b))
+            return (std::isnan (a) && std::isnan (b)) ? 0u : std::numeric_limits<uint64_t>::max();
+
+        auto ordered = [] (float x) noexcept -> int64_t
+        {
+            int32_t i = 0;
+            std::memcpy (&i, &x, sizeof (i));
+            return (i < 0) ? (int64_t) std::numeric_limits<int32_t>::min() - (int64_t) i : (int64_t) i;
+        };
+
+        const int64_t d = ordered (a) - ordered (b);
+        return (uint64_t) (d < 0 ? -d : d);
+    }
+
+    std::vector<Signal> buildCorpus (uint32_t seed)
+    {
+        const int n = (int) std::lround (kItemSeconds * kSampleRate);
+        std::vector<Signal> v;
+        for (const auto& item : kCorpus)
+            v.push_back (item.make (n, seed));
+        return v;
+    }
+
+    bool argValue (int argc, char** argv, const char* name, std::string& out)
+    {
+        for (int i = 1; i + 1 < argc; ++i)
+        {
+            if (std::string (argv[i]) == name)
+            {
+                out = argv[i + 1];
+                return true;
+            }
+        }
+        return false;
+    }
+
+    uint32_t envSeed() noexcept
+    {
+        if (const char* v = std::getenv ("CML_TEST_SEED"))
+        {
+            try { return (uint32_t) (std::stoull (v) & 0xFFFFFFFFu); }
+            catch (...) {}
+        }
+        return kDefaultSeed;
+    }
+
+    int runSelfCheck()
+    {
+        const auto corpus = buildCorpus (kDefaultSeed);
+        for (size_t k = 0; k < corpus.size(); ++k)
+        {
+            for (int os : kRenderOs)
+            {
+                const uint64_t h0 = fnv1a64 (render (corpus[k], os));
+                const uint64_t h1 = fnv1a64 (render (corpus[k], os));
+                if (h0 != h1)
+                {
+                    std::cout << "reference_golden DETAIL: " << entryName (kCorpus[k].name, os)
+                              << " run0=" << hex64 (h0) << " run1=" << hex64 (h1) << "\n";
+                    std::cout << "reference_golden FAIL (non-deterministic render)\n";
+                    return 1;
+                }
+            }
+        }
+
+        std::cout << "reference_golden PASS\n";
+        return 0;
+    }
+
+    int runWrite (const std::string& dirPath)
+    {
+        const juce::File dir (juce::File::getCurrentWorkingDirectory().getChildFile (juce::String (dirPath)));
+        if (! dir.createDirectory().wasOk())
+        {
+            std::cout << "reference_golden FAIL (create " << dirPath << ")\n";
+            return 1;
+        }
+
+        const uint32_t seed = envSeed();
+        const auto corpus = buildCorpus (seed);
+
+        std::ostringstream m;
+        m << "{\n";
+        m << "  \"tool\": \"reference_golden\",\n";
+        m << "  \"seed\": " << seed << ",\n";
+        m << "  \"sampleRate\": " << kSampleRate << ",\n";
+        m << "  \"blockSize\": " << kBlockSize << ",\n";
+        m << "  \"channels\": " << kChannels << ",\n";
+        m << "  \"entries\": [\n";
+
+        bool first = true;
+        for (size_t k = 0; k < corpus.size(); ++k)
+        {
+            for (int os : kRenderOs)
+            {
+                const Signal out = render (corpus[k], os);
+                const std::string name = entryName (kCorpus[k].name, os);
+                const std::string file = name + ".f32";
+
+                if (! writeF32 (dir.getChildFile (juce::String (file)).getFullPathName().toStdString(), out))
+                {
+                    std::cout << "reference_golden FAIL (write " << file << ")\n";
+                    return 1;
+                }
+
+                m << (first ? "" : ",\n")
+                  << "    { \"name\": \"" << name << "\", \"item\": \"" << kCorpus[k].name << "\", \"osIndex\": " << os
+                  << ", \"frames\": " << out.getNumSamples() << ", \"fnv1a64\": \"" << hex64 (fnv1a64 (out))
+                  << "\", \"file\": \"" << file << "\" }";
+                first = false;
+            }
+        }
+
+        m << "\n  ]\n}\n";
+
+        if (! dir.getChildFile ("manifest.json").replaceWithText (juce::String (m.str())))
+        {
+            std::cout << "reference_golden FAIL (write manifest.json)\n";
+            return 1;
+        }
+
+        std::cout << "reference_golden WROTE " << dir.getFullPathName() << "\n";
+        return 0;
+    }
+
+    int runCheck (const std::string& dirPath, bool exact, uint64_t maxUlp, double maxDiffDb)
+    {
+        const juce::File dir (juce::File::getCurrentWorkingDirectory().getChildFile (juce::String (dirPath)));
+        const juce::var manifest = juce::JSON::parse (dir.getChildFile ("manifest.json"));
+        const auto* entries = manifest["entries"].getArray();
+        if (entries == nullptr)
+        {
+            std::cout << "reference_golden FAIL (manifest " << dirPath << ")\n";
+            return 1;
+        }
+
+        if ((double) manifest["sampleRate"] != kSampleRate || (int) manifest["blockSize"] != kBlockSize)
+        {
+            std::cout << "reference_golden FAIL (manifest render config mismatch)\n";
+            return 1;
+        }
+
+        const uint32_t seed = (uint32_t) (int64_t) (double) manifest["seed"];
+        const auto corpus = buildCorpus (seed);
+        const double maxDiffLin = std::pow (10.0, maxDiffDb / 20.0);
+
+        int failures = 0;
+
+        for (const auto& e : *entries)
+        {
+            const juce::String item = e["item"].toString();
+            const int os = (int) e["osIndex"];
+
+            int k = -1;
+            for (size_t j = 0; j < corpus.size(); ++j)
+                if (item == kCorpus[j].name)
+                    k = (int) j;
+
+            if (k < 0)
+            {
+                std::cout << "reference_golden DETAIL: unknown corpus item " << item << "\n";
+                ++failures;
+                continue;
+            }
+
+            const Signal out = render (corpus[(size_t) k], os);
+            const std::string name = entryName (kCorpus[k].name, os);
+
+            if (exact)
+            {
+                const std::string want = e["fnv1a64"].toString().toStdString();
+                const std::string got  = hex64 (fnv1a64 (out));
+                const bool ok = (want == got);
+                if (! ok) ++failures;
+                std::cout << "reference_golden " << (ok ? "ok" : "MISMATCH") << " " << name << " want=" << want << " got=" << got << "\n";
+                continue;
+            }
+
+            Signal ref;
+            const auto refPath = dir.getChildFile (e["file"].toString()).getFullPathName().toStdString();
+            if (! readF32 (refPath, kChannels, ref) || ref.getNumSamples() != out.getNumSamples())
+            {
+                std::cout << "reference_golden DETAIL: reference render unreadable " << refPath << "\n";
+                ++failures;
+                continue;
+            }
+
+            uint64_t worstUlp = 0;
+            double worstAbs = 0.0;
+            int64_t violations = 0;
+
+            for (int c = 0; c < kChannels; ++c)
+            {
+                for (int i = 0; i < out.getNumSamples(); ++i)
+                {
+                    const float a = out.getSample (c, i);
+                    const float b = ref.getSample (c, i);
+                    const uint64_t u = ulpDistance (a, b);
+                    const double d = std::abs ((double) a - (double) b);
+                    worstUlp = juce::jmax (worstUlp, u);
+                    if (std::isfinite (d)) worstAbs = juce::jmax (worstAbs, d);
+                    if (u > maxUlp && ! (d <= maxDiffLin))
+                        ++violations;
+                }
+            }
+
+            const bool ok = (violations == 0);
+            if (! ok) ++failures;
+            std::cout << "reference_golden " << (ok ? "ok" : "DRIFT") << " " << name
+                      << " maxUlp=" << worstUlp
+                      << " maxDiffDb=" << 20.0 * std::log10 (worstAbs + 1.0e-30)
+                      << " violations=" << violations << "\n";
+        }
+
+        if (failures > 0)
+        {
+            std::cout << "reference_golden FAIL (" << failures << " entr" << (failures == 1 ? "y" : "ies") << ")\n";
+            return 1;
+        }
+
+        std::cout << "reference_golden PASS\n";
+        return 0;
+    }
+}
+
+int main (int argc, char** argv)
+{
+    juce::ScopedJuceInitialiser_GUI juceInit;
+
+    std::string v;
+    if (argValue (argc, argv, "--write", v))
+        return runWrite (v);
+
+    if (argValue (argc, argv, "--check", v))
+    {
+        std::string mode = "exact", tmp;
+        argValue (argc, argv, "--mode", mode);
+
+        uint64_t maxUlp = (uint64_t) kDefaultMaxUlp;
+        double maxDiffDb = kDefaultMaxDiffDb;
+        if (argValue (argc, argv, "--max-ulp", tmp))     maxUlp = (uint64_t) std::stoull (tmp);
+        if (argValue (argc, argv, "--max-diff-db", tmp)) maxDiffDb = std::stod (tmp);
+
+        return runCheck (v, mode != "tolerance", maxUlp, maxDiffDb);
+    }
+
+    return runSelfCheck();
+}
@@ -0,0 +1,223 @@
+#include "AudioThreadGuard.h"
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+#if defined(__linux__) && defined(__GLIBC__)
+ #define AUDIO_THREAD_GUARD_HAS_LIBC_HOOKS 1
+ #include <cerrno>
+ #include <dlfcn.h>
+ #include <pthread.h>
+ #include <sched.h>
+#else
+ #define AUDIO_THREAD_GUARD_HAS_LIBC_HOOKS 0
+#endif
+
+namespace
+{
+    // Constant-initialised TLS: safe to touch from inside the allocator.
+    thread_local bool tlArmed = false;
+    thread_local audio_thread_guard::Counts tlCounts {};
+}
+
+#if AUDIO_THREAD_GUARD_HAS_LIBC_HOOKS
+
+extern "C"
+{
+    void* __libc_malloc (std::size_t);
+    void* __libc_calloc (std::size_t, std::size_t);
+    void* __libc_realloc (void*, std::size_t);
+    void* __libc_memalign (std::size_t, std::size_t);
+    void  __libc_free (void*);
+}
+
+namespace
+{
+    using MutexLockFn = int (*) (pthread_mutex_t*);
+
+    MutexLockFn realMutexLock = nullptr;
+    thread_local bool tlResolvingLock = false;
+
+    inline void noteMalloc() noexcept
+    {
+        if (tlArmed)
+            ++tlCounts.mallocCalls;
+    }
+
+    inline void* rawAlloc (std::size_t n) noexcept { return __libc_malloc (n); }
+    inline void  rawFree (void* p) noexcept        { __libc_free (p); }
+
+    void resolveMutexLock() noexcept
+    {
+        if (realMutexLock != nullptr || tlResolvingLock)
+            return;
+
+        tlResolvingLock = true;
+        realMutexLock = (MutexLockFn) dlsym (RTLD_NEXT, "pthread_mutex_lock");
+        tlResolvingLock = false;
+    }
+}
+
+// glibc-sanctioned malloc replacement: every entry forwards to the libc allocator, counting only while armed.
+extern "C" void* malloc (std::size_t n) noexcept
+{
+    noteMalloc();
+    return __libc_malloc (n);
+}
+
+extern "C" void* calloc (std::size_t count, std::size_t n) noexcept
+{
+    noteMalloc();
+    return __libc_calloc (count, n);
+}
+
+extern "C" void* realloc (void* p, std::size_t n) noexcept
+{
+    noteMalloc();
+    return __libc_realloc (p, n);
+}
+
+extern "C" void* memalign (std::size_t alignment, std::size_t n) noexcept
+{
+    noteMalloc();
+    return __libc_memalign (alignment, n);
+}
+
+extern "C" void* aligned_alloc (std::size_t alignment, std::size_t n) noexcept
+{
+    noteMalloc();
+    return __libc_memalign (alignment, n);
+}
+
+extern "C" int posix_memalign (void** out, std::size_t alignment, std::size_t n) noexcept
+{
+    noteMalloc();
+
+    if (alignment < sizeof (void*) || (alignment & (alignment - 1)) != 0)
+        return EINVAL;
+
+    void* p = __libc_memalign (alignment, n);
+    if (p == nullptr)
+        return ENOMEM;
+
+    *out = p;
+    return 0;
+}
+
+extern "C" void free (void* p) noexcept
+{
+    // Releasing is as much a realtime violation as allocating (the arena lock is taken without pthread_mutex_lock).
+    if (p != nullptr && tlArmed)
+        ++tlCounts.freeCalls;
+
+    __libc_free (p);
+}
+
+extern "C" int pthread_mutex_lock (pthread_mutex_t* m) noexcept
+{
+    if (tlArmed)
+        ++tlCounts.lockCalls;
+
+    if (realMutexLock == nullptr)
+        resolveMutexLock();
+
+    if (realMutexLock != nullptr)
+        return realMutexLock (m);
+
+    // Only reachable while dlsym itself is resolving (before install()); never on an armed thread.
+    int r = 0;
+    while ((r = pthread_mutex_trylock (m)) == EBUSY)
+        sched_yield();
+    return r;
+}
+
+#else
+
+namespace
+{
+    inline void* rawAlloc (std::size_t n) noexcept { return std::malloc (n); }
+    inline void  rawFree (void* p) noexcept        { std::free (p); }
+}
+
+#endif
+
+namespace
+{
+    // operator delete releases through rawFree (never the interposed free), so each release is counted once.
+    inline void rawDelete (void* p) noexcept
+    {
+        if (p != nullptr && tlArmed)
+            ++tlCounts.deleteCalls;
+
+        rawFree (p);
+    }
+}
+
+// Global operator new/delete replacement (portable part of the guard).
+void* operator new (std::size_t n)
+{
+    if (tlArmed)
+        ++tlCounts.newCalls;
+
+    if (void* p = rawAlloc (n > 0 ? n : 1))
+        return p;
+
+    throw std::bad_alloc();
+}
+
+void* operator new[] (std::size_t n)
+{
+    return ::operator new (n);
+}
+
+void* operator new (std::size_t n, const std::nothrow_t&) noexcept
+{
+    if (tlArmed)
+        ++tlCounts.newCalls;
+
+    return rawAlloc (n > 0 ? n : 1);
+}
+
+void* operator new[] (std::size_t n, const std::nothrow_t& tag) noexcept
+{
+    return ::operator new (n, tag);
+}
+
+void operator delete (void* p) noexcept                        { rawDelete (p); }
+void operator delete[] (void* p) noexcept                      { rawDelete (p); }
+void operator delete (void* p, std::size_t) noexcept           { rawDelete (p); }
+void operator delete[] (void* p, std::size_t) noexcept         { rawDelete (p); }
+void operator delete (void* p, const std::nothrow_t&) noexcept   { rawDelete (p); }
+void operator delete[] (void* p, const std::nothrow_t&) noexcept { rawDelete (p); }
+
+namespace audio_thread_guard
+{
+    void install() noexcept
+    {
+       #if AUDIO_THREAD_GUARD_HAS_LIBC_HOOKS
+        resolveMutexLock();
+       #endif
+    }
+
+    bool libcHooksAvailable() noexcept
+    {
+       #if AUDIO_THREAD_GUARD_HAS_LIBC_HOOKS
+        return realMutexLock != nullptr;
+       #else
+        return false;
+       #endif
+    }
+
+    void arm() noexcept
+    {
+        tlCounts = Counts {};
+        tlArmed = true;
+    }
+
+    Counts disarm() noexcept
+    {
+        tlArmed = false;
+        return tlCounts;
+    }
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstdint>
+
+//// [CML:TEST] Audio-thread realtime guard (B006 enforcement)
+//
+// Interposes operator new/delete / malloc family + free / pthread_mutex_lock for this test executable.
+// Counting is per-thread and only active while armed, so setup/teardown (prepareToPlay, parameter
+// writes, offline tier builds) stay unrestricted while processBlock calls are policed.
+//
+// malloc/free/pthread interposition is glibc-only (AUDIO_THREAD_GUARD_HAS_LIBC_HOOKS); elsewhere only
+// operator new/delete are observed.
+
+namespace audio_thread_guard
+{
+    struct Counts
+    {
+        std::uint64_t newCalls    = 0;
+        std::uint64_t mallocCalls = 0;
+        std::uint64_t deleteCalls = 0; // non-null operator delete (any overload)
+        std::uint64_t freeCalls   = 0; // non-null free()
+        std::uint64_t lockCalls   = 0;
+
+        bool clean() const noexcept
+        {
+            return newCalls == 0 && mallocCalls == 0 && deleteCalls == 0 && freeCalls == 0 && lockCalls == 0;
+        }
+    };
+
+    // Resolves forwarding symbols up front (must be called before the first arm()).
+    void install() noexcept;
+
+    bool libcHooksAvailable() noexcept;
+
+    void arm() noexcept;
+    Counts disarm() noexcept;
+
+    // RAII arm/disarm around a processing call; counts are accumulated into the caller's Counts on exit.
+    struct ScopedArm
+    {
+        explicit ScopedArm (Counts& out) noexcept : result (out) { arm(); }
+        ~ScopedArm() noexcept
+        {
+            const Counts c = disarm();
+            result.newCalls    += c.newCalls;
+            result.mallocCalls += c.mallocCalls;
+            result.deleteCalls += c.deleteCalls;
+            result.freeCalls   += c.freeCalls;
+            result.lockCalls   += c.lockCalls;
+        }
+
+        ScopedArm (const ScopedArm&) = delete;
+        ScopedArm& operator= (const ScopedArm&) = delete;
+
+    private:
+        Counts& result;
+    };
+}
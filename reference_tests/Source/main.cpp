@@ -3,12 +3,19 @@
 #include <limits>
 #include <cstdlib>
 #include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <thread>
+#include <vector>
 
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_audio_basics/juce_audio_basics.h>
 
 #include "reference_core/reference_core.h"
 #include "PluginProcessor.h"
+#include "StageProfiler.h"
+#include "MeterTransport.h"
+#include "AudioThreadGuard.h"
 
 static bool bufferAllFinite (const juce::AudioBuffer<float>& b) noexcept
 {
@@ -403,6 +410,1541 @@ if (! bufferAllFinite (buf))
         return 1;
     }
 
+    //// [CML:TEST] Oversize Host Block (Tiled Oversampling)
+    // A block 8x larger than prepared must still take the oversampled path and match prepared-size blocks.
+    // Nonrealtime keeps the overload scheduler out of it (output independent of machine speed).
+    {
+        constexpr double kSr = 48000.0;
+        constexpr int    kPrepared = 512;
+        constexpr int    kOversize = 8 * kPrepared;
+
+        auto render = [&] (int blockSize, juce::AudioBuffer<float>& out)
+        {
+            CompassMasteringLimiterAudioProcessor p;
+            p.setPlayConfigDetails (2, 2, kSr, kPrepared);
+            p.setNonRealtime (true);
+            setParamRaw (p, "drive", kDriveMaxDb);
+            setParamRaw (p, "ceiling", kCeilingHardDbTP);
+            setParamRaw (p, "oversampling_min", (float) kOversamplingMaxIndex);
+            p.prepareToPlay (kSr, kPrepared);
+
+            const double w = 2.0 * 3.14159265358979323846 * kProbeToneHz / kSr;
+            for (int i = 0; i < out.getNumSamples(); ++i)
+            {
+                const float x = (float) std::sin (w * (double) i) * kToneAmpLin;
+                out.setSample (0, i, x);
+                out.setSample (1, i, x);
+            }
+
+            juce::MidiBuffer midi;
+            for (int pos = 0; pos < out.getNumSamples(); pos += blockSize)
+            {
+                juce::AudioBuffer<float> view (out.getArrayOfWritePointers(), 2, pos, blockSize);
+                p.processBlock (view, midi);
+            }
+
+            p.releaseResources();
+        };
+
+        juce::AudioBuffer<float> outPrepared (2, 4 * kOversize);
+        juce::AudioBuffer<float> outOversize (2, 4 * kOversize);
+        render (kPrepared, outPrepared);
+        render (kOversize, outOversize);
+
+        float maxDiff = 0.0f;
+        for (int c = 0; c < 2; ++c)
+            for (int i = 0; i < outPrepared.getNumSamples(); ++i)
+                maxDiff = std::max (maxDiff, std::abs (outPrepared.getSample (c, i) - outOversize.getSample (c, i)));
+
+        if (! bufferAllFinite (outOversize) || maxDiff > 1.0e-6f)
+        {
+            std::cout << "reference_tests DETAIL: oversize block max diff " << maxDiff << "\n";
+            std::cout << "reference_tests FAIL (oversize host block)\n";
+            return 1;
+        }
+    }
+
+    //// [CML:TEST] Block Partition Determinism (B002)
+    // The same stream + parameter timeline must render to identical float bits however it is cut into blocks
+    // (fixed, prime-sized, single-sample, oversize, seeded random). Parameter edits land at the same sample
+    // positions in every partition. Nonrealtime: the overload scheduler never runs.
+    {
+        constexpr double kSr = 48000.0;
+        constexpr int    kPrepared = 512;
+        constexpr int    kTotal = 72000;
+        constexpr int    kEditA = 36000; // drive / link change
+        constexpr int    kEditB = 54000; // trim change
+
+        juce::AudioBuffer<float> input (2, kTotal);
+        {
+            uint32_t prng = 0x5EED5u;
+            const double w = 2.0 * 3.14159265358979323846 * kProbeToneHz / kSr;
+            for (int i = 0; i < kTotal; ++i)
+            {
+                prng = prng * 1664525u + 1013904223u;
+                const float noise = ((float) ((prng >> 8) & 0x00FFFFFFu) / (float) 0x01000000u - 0.5f);
+                const bool burst = ((i / 4800) % 3) == 1;
+                const bool gap   = ((i / 4800) % 5) == 4;
+                const float tone = (float) std::sin (w * (double) i) * 0.8f;
+                const float x = (gap ? 0.0f : tone + (burst ? 0.6f * noise : 0.0f));
+                input.setSample (0, i, x);
+                input.setSample (1, i, gap ? 0.0f : 0.7f * tone - (burst ? 0.4f * noise : 0.0f));
+            }
+        }
+
+        auto render = [&] (const std::vector<int>& sizes, juce::AudioBuffer<float>& out)
+        {
+            CompassMasteringLimiterAudioProcessor p;
+            p.setPlayConfigDetails (2, 2, kSr, kPrepared);
+            p.setNonRealtime (true);
+            setParamRaw (p, "trim", 0.0f);
+            setParamRaw (p, "drive", 12.0f);
+            setParamRaw (p, "ceiling", -1.0f);
+            setParamRaw (p, "adaptive_bias", 0.5f);
+            setParamRaw (p, "stereo_link", 0.5f);
+            setParamRaw (p, "oversampling_min", (float) kOversamplingMaxIndex);
+            p.prepareToPlay (kSr, kPrepared);
+
+            out.makeCopyOf (input);
+            juce::MidiBuffer midi;
+            int pos = 0;
+            for (int bs : sizes)
+            {
+                if (pos == kEditA)
+                {
+                    setParamRaw (p, "drive", 4.0f);
+                    setParamRaw (p, "stereo_link", 1.0f);
+                }
+                if (pos == kEditB)
+                    setParamRaw (p, "trim", -3.0f);
+
+                juce::AudioBuffer<float> view (out.getArrayOfWritePointers(), 2, pos, bs);
+                p.processBlock (view, midi);
+                pos += bs;
+            }
+
+            p.releaseResources();
+        };
+
+        // Cuts the stream into blocks from next(), always splitting at the parameter edit positions.
+        auto makePartition = [&] (auto next)
+        {
+            std::vector<int> sizes;
+            int pos = 0;
+            while (pos < kTotal)
+            {
+                int bs = juce::jmax (1, next());
+                for (int edit : { kEditA, kEditB })
+                    if (pos < edit && pos + bs > edit)
+                        bs = edit - pos;
+                bs = juce::jmin (bs, kTotal - pos);
+                sizes.push_back (bs);
+                pos += bs;
+            }
+            return sizes;
+        };
+
+        uint32_t prngPart = 0xB10C5u;
+        const std::vector<int> partitions[] = {
+            makePartition ([] { return kPrepared; }),
+            makePartition ([] { return 37; }),
+            makePartition ([] { return 1; }),
+            makePartition ([] { return 8192; }),
+            makePartition ([&prngPart] { prngPart = prngPart * 1664525u + 1013904223u; return 1 + (int) ((prngPart >> 8) % 3000u); })
+        };
+        const char* partitionNames[] = { "512", "37", "1", "8192", "random" };
+
+        juce::AudioBuffer<float> reference (2, kTotal);
+        render (partitions[0], reference);
+
+        if (! bufferAllFinite (reference))
+        {
+            std::cout << "reference_tests FAIL (block partition reference non-finite)\n";
+            return 1;
+        }
+
+        juce::AudioBuffer<float> candidate (2, kTotal);
+        for (size_t k = 1; k < std::size (partitions); ++k)
+        {
+            render (partitions[k], candidate);
+
+            for (int c = 0; c < 2; ++c)
+            {
+                if (std::memcmp (reference.getReadPointer (c), candidate.getReadPointer (c), sizeof (float) * (size_t) kTotal) != 0)
+                {
+                    int first = 0;
+                    while (first < kTotal && reference.getSample (c, first) == candidate.getSample (c, first))
+                        ++first;
+
+                    std::cout << "reference_tests DETAIL: partition " << partitionNames[k] << " ch " << c
+                              << " first mismatch at sample " << first << "\n";
+                    std::cout << "reference_tests FAIL (block partition determinism)\n";
+                    return 1;
+                }
+            }
+        }
+    }
+
+    //// [CML:TEST] Double Precision Path Parity
+    // Same scripted input through the float and double processBlock overloads.
+    // Input is float-representable and the oversampled engine is shared, so outputs must match.
+    {
+        constexpr double kSr = 48000.0;
+        constexpr int    kBs = 256;
+        constexpr int    kBlocks = 200;
+        constexpr double kParityMaxAbs = 1.0e-6;
+
+        CompassMasteringLimiterAudioProcessor procF;
+        CompassMasteringLimiterAudioProcessor procD;
+
+        auto prepareStress = [] (CompassMasteringLimiterAudioProcessor& p)
+        {
+            p.setPlayConfigDetails (2, 2, kSr, kBs);
+            setParamRaw (p, "trim", 0.0f);
+            setParamRaw (p, "stereo_link", 1.0f);
+            setParamRaw (p, "drive", kDriveMaxDb);
+            setParamRaw (p, "ceiling", kCeilingHardDbTP);
+            setParamRaw (p, "adaptive_bias", kAdaptiveBiasAgg01);
+            setParamRaw (p, "oversampling_min", 0.0f);
+            p.prepareToPlay (kSr, kBs);
+        };
+
+        prepareStress (procF);
+        prepareStress (procD);
+
+        if (! procD.supportsDoublePrecisionProcessing())
+        {
+            std::cout << "reference_tests FAIL (double precision unsupported)\n";
+            return 1;
+        }
+
+        juce::AudioBuffer<float>  bufF (2, kBs);
+        juce::AudioBuffer<double> bufD (2, kBs);
+        juce::MidiBuffer midi;
+
+        double phase = 0.0;
+        const double w = 2.0 * 3.14159265358979323846 * kProbeToneHz / kSr;
+        double maxAbsDiff = 0.0;
+
+        for (int k = 0; k < kBlocks; ++k)
+        {
+            for (int i = 0; i < kBs; ++i)
+            {
+                const float s = (float) std::sin (phase) * kToneAmpLin;
+                phase += w;
+                for (int ch = 0; ch < 2; ++ch)
+                {
+                    bufF.setSample (ch, i, s);
+                    bufD.setSample (ch, i, (double) s);
+                }
+            }
+
+            procF.processBlock (bufF, midi);
+            procD.processBlock (bufD, midi);
+
+            for (int ch = 0; ch < 2; ++ch)
+            {
+                for (int i = 0; i < kBs; ++i)
+                {
+                    const double yD = bufD.getSample (ch, i);
+                    if (! std::isfinite (yD))
+                    {
+                        std::cout << "reference_tests FAIL (double precision non-finite)\n";
+                        return 1;
+                    }
+                    maxAbsDiff = std::max (maxAbsDiff, std::abs (yD - (double) bufF.getSample (ch, i)));
+                }
+            }
+        }
+
+        procF.releaseResources();
+        procD.releaseResources();
+
+        if (maxAbsDiff > kParityMaxAbs)
+        {
+            std::cout << "reference_tests DETAIL: double/float parity maxAbsDiff=" << maxAbsDiff << "\n";
+            std::cout << "reference_tests FAIL (double precision parity)\n";
+            return 1;
+        }
+    }
+
+    //// [CML:TEST] Double Precision Native Path
+    // Oversampling off: the engine runs in the host's sample type end to end. Input carries detail below float
+    // resolution and stays under the ceiling (no softclip), so the output is exactly input x captured gain.
+    // Reference: the double input times the double path's own captured gain, evaluated in double.
+    {
+        constexpr double kSr = 48000.0;
+        constexpr int    kBs = 256;
+        constexpr int    kBlocks = 200;
+        constexpr int    kTotal = kBs * kBlocks;
+        constexpr double kDoubleRefMaxAbs = 1.0e-12;
+
+        CompassMasteringLimiterAudioProcessor procF;
+        CompassMasteringLimiterAudioProcessor procD;
+
+        std::vector<float> gFL ((size_t) kTotal, 1.0f), gFR ((size_t) kTotal, 1.0f);
+        std::vector<float> gDL ((size_t) kTotal, 1.0f), gDR ((size_t) kTotal, 1.0f);
+
+        auto prepareNative = [] (CompassMasteringLimiterAudioProcessor& p, std::vector<float>& gL, std::vector<float>& gR)
+        {
+            p.setPlayConfigDetails (2, 2, kSr, kBs);
+            p.setOversamplingPathEnabled (false);
+            setParamRaw (p, "trim", 0.0f);
+            setParamRaw (p, "stereo_link", 1.0f);
+            setParamRaw (p, "drive", 6.0f);
+            setParamRaw (p, "ceiling", 0.0f);
+            setParamRaw (p, "adaptive_bias", kAdaptiveBiasAgg01);
+            p.prepareToPlay (kSr, kBs);
+            p.setGainCaptureTarget (gL.data(), gR.data(), kTotal);
+        };
+
+        prepareNative (procF, gFL, gFR);
+        prepareNative (procD, gDL, gDR);
+
+        juce::AudioBuffer<float>  bufF (2, kBs);
+        juce::AudioBuffer<double> bufD (2, kBs);
+        juce::MidiBuffer midi;
+
+        const double w = 2.0 * 3.14159265358979323846 * kProbeToneHz / kSr;
+        std::vector<double> xD ((size_t) kTotal);
+        for (int i = 0; i < kTotal; ++i)
+            xD[(size_t) i] = 0.25 * std::sin (w * (double) i) + 1.0e-9 * std::sin (0.37 * (double) i);
+
+        double maxErrF = 0.0;
+        double maxErrD = 0.0;
+
+        for (int k = 0; k < kBlocks; ++k)
+        {
+            for (int ch = 0; ch < 2; ++ch)
+            {
+                for (int i = 0; i < kBs; ++i)
+                {
+                    const double x = xD[(size_t) (k * kBs + i)];
+                    bufD.setSample (ch, i, x);
+                    bufF.setSample (ch, i, (float) x);
+                }
+            }
+
+            procF.processBlock (bufF, midi);
+            procD.processBlock (bufD, midi);
+
+            for (int ch = 0; ch < 2; ++ch)
+            {
+                const std::vector<float>& g = (ch == 0 ? gDL : gDR);
+                for (int i = 0; i < kBs; ++i)
+                {
+                    const int j = k * kBs + i;
+                    const double yD = bufD.getSample (ch, i);
+                    if (! std::isfinite (yD))
+                    {
+                        std::cout << "reference_tests FAIL (double native path non-finite)\n";
+                        return 1;
+                    }
+
+                    const double ref = xD[(size_t) j] * (double) g[(size_t) j];
+                    maxErrD = std::max (maxErrD, std::abs (yD - ref));
+                    maxErrF = std::max (maxErrF, std::abs ((double) bufF.getSample (ch, i) - ref));
+                }
+            }
+        }
+
+        const int capturedD = procD.getGainCaptureCount();
+        procF.setGainCaptureTarget (nullptr, nullptr, 0);
+        procD.setGainCaptureTarget (nullptr, nullptr, 0);
+        procF.releaseResources();
+        procD.releaseResources();
+
+        std::cout << "reference_tests DETAIL: native path error vs double reference: double=" << maxErrD
+                  << " float=" << maxErrF << "\n";
+
+        if (capturedD < kTotal)
+        {
+            std::cout << "reference_tests FAIL (double native path gain capture " << capturedD << "/" << kTotal << ")\n";
+            return 1;
+        }
+
+        if (! (maxErrD <= kDoubleRefMaxAbs) || ! (maxErrD < maxErrF))
+        {
+            std::cout << "reference_tests FAIL (double native path precision)\n";
+            return 1;
+        }
+    }
+
+    //// [CML:TEST] Linked Fast Path Equivalence
+    // stereo_link ON runs one envelope chain whenever both per-channel chains would compute the same values
+    // (default path). Reference: the per-channel chains + jmax (setLinkedFastPathEnabled (false)). The output and
+    // captured gain must match bit-for-bit on identical channels (fast path engaged throughout) and on
+    // decorrelated stereo (fast path falls back per sample).
+    {
+        constexpr double kSr = 48000.0;
+        constexpr int    kBs = 512;
+        constexpr int    kTotal = 96000;
+
+        enum class Stereo { Identical, ToneNoise, Noise, PannedBursts };
+        enum class Path   { Default, Reference };
+
+        auto render = [&] (Path path, Stereo kind, juce::AudioBuffer<float>& out,
+                           std::vector<float>& gL, std::vector<float>& gR)
+        {
+            CompassMasteringLimiterAudioProcessor p;
+            p.setPlayConfigDetails (2, 2, kSr, kBs);
+            p.setNonRealtime (true);
+            if (path == Path::Reference)
+                p.setLinkedFastPathEnabled (false);
+            setParamRaw (p, "drive", 12.0f);
+            setParamRaw (p, "ceiling", -1.0f);
+            setParamRaw (p, "adaptive_bias", 0.5f);
+            setParamRaw (p, "stereo_link", 1.0f);
+            setParamRaw (p, "oversampling_min", 1.0f);
+            p.prepareToPlay (kSr, kBs);
+
+            gL.assign ((size_t) kTotal, 1.0f);
+            gR.assign ((size_t) kTotal, 1.0f);
+            p.setGainCaptureTarget (gL.data(), gR.data(), kTotal);
+
+            uint32_t prng = 0x11A7Du;
+            auto noise = [&prng]
+            {
+                prng = prng * 1664525u + 1013904223u;
+                return ((float) ((prng >> 8) & 0x00FFFFFFu) / (float) 0x01000000u - 0.5f);
+            };
+
+            const double wL = 2.0 * 3.14159265358979323846 * kProbeToneHz / kSr;
+            const double wR = 2.0 * 3.14159265358979323846 * 1370.0 / kSr;
+            out.setSize (2, kTotal, false, false, true);
+            for (int i = 0; i < kTotal; ++i)
+            {
+                const float env = ((i / 6000) % 2 == 0 ? 0.9f : 0.35f);
+                const float l = (float) std::sin (wL * (double) i) * env;
+                float r = l;
+                float lOut = l;
+
+                switch (kind)
+                {
+                    case Stereo::Identical:    break;
+                    case Stereo::ToneNoise:    r = (float) std::sin (wR * (double) i) * (1.25f - env) + 0.2f * noise(); break;
+                    case Stereo::Noise:        lOut = 1.6f * noise() * env; r = 1.6f * noise() * (1.25f - env); break;
+                    case Stereo::PannedBursts: r = (float) std::sin (wR * (double) i) * (env > 0.5f ? 0.1f : 0.95f); break;
+                }
+
+                out.setSample (0, i, lOut);
+                out.setSample (1, i, r);
+            }
+
+            juce::MidiBuffer midi;
+            for (int pos = 0; pos < kTotal; pos += kBs)
+            {
+                juce::AudioBuffer<float> view (out.getArrayOfWritePointers(), 2, pos, juce::jmin (kBs, kTotal - pos));
+                p.processBlock (view, midi);
+            }
+
+            p.setGainCaptureTarget (nullptr, nullptr, 0);
+            p.releaseResources();
+        };
+
+        auto sameBits = [] (const juce::AudioBuffer<float>& x, const juce::AudioBuffer<float>& y)
+        {
+            for (int c = 0; c < 2; ++c)
+                if (std::memcmp (x.getReadPointer (c), y.getReadPointer (c), sizeof (float) * (size_t) kTotal) != 0)
+                    return false;
+            return true;
+        };
+
+        juce::AudioBuffer<float> full, dflt;
+        std::vector<float> fullGL, fullGR, dfltGL, dfltGR;
+
+        for (Stereo kind : { Stereo::Identical, Stereo::ToneNoise, Stereo::Noise, Stereo::PannedBursts })
+        {
+            render (Path::Default,   kind, dflt, dfltGL, dfltGR);
+            render (Path::Reference, kind, full, fullGL, fullGR);
+
+            if (! bufferAllFinite (dflt) || ! sameBits (dflt, full) || dfltGL != fullGL || dfltGR != fullGR)
+            {
+                std::cout << "reference_tests FAIL (linked fast path differs from the two-chain path, signal "
+                          << (int) kind << ")\n";
+                return 1;
+            }
+        }
+    }
+
+    //// [CML:TEST] Gain Capture Round Trip
+    // compass_render contract: the exported gain track, aligned by getGainCaptureLatencySamples() and applied to the
+    // input, reproduces the latency-compensated render. Residual: the softclip knee and the oversampled-domain gain
+    // ripple that a per-native-sample track cannot carry.
+    {
+        constexpr double kSr = 48000.0;
+        constexpr int    kBs = 512;
+        constexpr int    kLen = 96000;
+        constexpr int    kSkip = 4800; // envelopes settle from the t=0 step
+        constexpr double kRoundTripMaxErrDb = -30.0; // residual RMS relative to the render RMS
+
+        CompassMasteringLimiterAudioProcessor p;
+        p.setPlayConfigDetails (2, 2, kSr, kBs);
+        p.setNonRealtime (true);
+        setParamRaw (p, "drive", 9.0f);
+        setParamRaw (p, "ceiling", -1.0f);
+        setParamRaw (p, "trim", 0.0f);
+        setParamRaw (p, "adaptive_bias", 0.5f);
+        setParamRaw (p, "stereo_link", 1.0f);
+        setParamRaw (p, "oversampling_min", 1.0f);
+        p.prepareToPlay (kSr, kBs);
+
+        const int latency = juce::jmax (0, p.getLatencySamples());
+        const int upLat = p.getGainCaptureLatencySamples();
+        const int total = kLen + latency;
+
+        if (upLat < 0 || upLat > latency)
+        {
+            std::cout << "reference_tests DETAIL: gain capture latency=" << upLat << " reported=" << latency << "\n";
+            std::cout << "reference_tests FAIL (gain capture latency)\n";
+            return 1;
+        }
+
+        juce::AudioBuffer<float> in (2, total);
+        in.clear();
+        const double wL = 2.0 * 3.14159265358979323846 * kProbeToneHz / kSr;
+        const double wR = 2.0 * 3.14159265358979323846 * 1370.0 / kSr;
+        for (int i = 0; i < kLen; ++i)
+        {
+            const float env = ((i / 6000) % 2 == 0 ? 0.9f : 0.35f);
+            in.setSample (0, i, (float) std::sin (wL * (double) i) * env);
+            in.setSample (1, i, (float) std::sin (wR * (double) i) * (1.25f - env));
+        }
+
+        juce::AudioBuffer<float> work;
+        work.makeCopyOf (in);
+
+        std::vector<float> gL ((size_t) total, 1.0f), gR ((size_t) total, 1.0f);
+        p.setGainCaptureTarget (gL.data(), gR.data(), total);
+
+        juce::MidiBuffer midi;
+        for (int pos = 0; pos < total; pos += kBs)
+        {
+            juce::AudioBuffer<float> view (work.getArrayOfWritePointers(), 2, pos, juce::jmin (kBs, total - pos));
+            p.processBlock (view, midi);
+        }
+
+        const int captured = p.getGainCaptureCount();
+        p.setGainCaptureTarget (nullptr, nullptr, 0);
+        p.releaseResources();
+
+        if (captured < total)
+        {
+            std::cout << "reference_tests FAIL (gain capture count " << captured << "/" << total << ")\n";
+            return 1;
+        }
+
+        double sumErr2 = 0.0;
+        double sumOut2 = 0.0;
+        for (int c = 0; c < 2; ++c)
+        {
+            const float* x = in.getReadPointer (c);
+            const float* y = work.getReadPointer (c);
+            const std::vector<float>& g = (c == 0 ? gL : gR);
+            for (int j = kSkip; j < kLen; ++j)
+            {
+                const double applied = (double) x[j] * (double) g[(size_t) (j + upLat)];
+                const double rendered = (double) y[j + latency];
+                sumErr2 += (applied - rendered) * (applied - rendered);
+                sumOut2 += rendered * rendered;
+            }
+        }
+
+        const double errDb = linToDb (std::sqrt (sumErr2 / juce::jmax (1.0e-30, sumOut2)));
+        std::cout << "reference_tests DETAIL: gain capture round trip residual=" << errDb
+                  << " dB (upLat=" << upLat << " latency=" << latency << ")\n";
+
+        if (! (errDb <= kRoundTripMaxErrDb))
+        {
+            std::cout << "reference_tests FAIL (gain capture round trip)\n";
+            return 1;
+        }
+    }
+
+    //// [CML:TEST] CPU-Idle Bypass Suspension
+    // Once the bypass ramp reaches dry, the engine is suspended and the output is exactly the input delayed by
+    // the reported latency. Un-bypass keeps that dry output through the hidden pre-roll, then crossfades back
+    // to a limited (ceiling-bound) wet signal.
+    {
+        constexpr double kSr = 48000.0;
+        constexpr int    kBs = 512;
+        constexpr int    kBlocks = 100;
+        constexpr int    kBypassOnBlock  = 20;
+        constexpr int    kBypassOffBlock = 60;
+        constexpr int    kTotal = kBlocks * kBs;
+        constexpr float  kCeilingDb = -1.0f;
+
+        CompassMasteringLimiterAudioProcessor p;
+        p.setPlayConfigDetails (2, 2, kSr, kBs);
+        setParamRaw (p, "drive", 12.0f);
+        setParamRaw (p, "ceiling", kCeilingDb);
+        setParamRaw (p, "oversampling_min", 1.0f);
+        setParamRaw (p, "bypass", 0.0f);
+        p.prepareToPlay (kSr, kBs);
+
+        const int latency = p.getLatencySamples();
+
+        juce::AudioBuffer<float> in (2, kTotal);
+        uint32_t prng = 0xB1A55u;
+        const double w = 2.0 * 3.14159265358979323846 * kProbeToneHz / kSr;
+        for (int i = 0; i < kTotal; ++i)
+        {
+            prng = prng * 1664525u + 1013904223u;
+            const float noise = ((float) ((prng >> 8) & 0x00FFFFFFu) / (float) 0x01000000u - 0.5f);
+            const float s = (float) std::sin (w * (double) i) * 0.8f;
+            in.setSample (0, i, s + 0.1f * noise);
+            in.setSample (1, i, s - 0.1f * noise);
+        }
+
+        juce::AudioBuffer<float> out;
+        out.makeCopyOf (in);
+
+        juce::MidiBuffer midi;
+        bool suspendedSeen = false;
+        for (int k = 0; k < kBlocks; ++k)
+        {
+            if (k == kBypassOnBlock)  setParamRaw (p, "bypass", 1.0f);
+            if (k == kBypassOffBlock) setParamRaw (p, "bypass", 0.0f);
+
+            juce::AudioBuffer<float> view (out.getArrayOfWritePointers(), 2, k * kBs, kBs);
+            p.processBlock (view, midi);
+
+            if (k > kBypassOnBlock && k < kBypassOffBlock)
+                suspendedSeen = suspendedSeen || p.isBypassSuspended();
+        }
+
+        if (! suspendedSeen || p.isBypassSuspended() || ! bufferAllFinite (out))
+        {
+            std::cout << "reference_tests FAIL (bypass suspension state)\n";
+            return 1;
+        }
+
+        // Dry span: first fully suspended block through the first block of the pre-roll.
+        for (int c = 0; c < 2; ++c)
+        {
+            for (int i = (kBypassOnBlock + 1) * kBs; i < (kBypassOffBlock + 1) * kBs; ++i)
+            {
+                const float dry = (i >= latency ? in.getSample (c, i - latency) : 0.0f);
+                if (out.getSample (c, i) != dry)
+                {
+                    std::cout << "reference_tests FAIL (suspended bypass is not the latency-matched input)\n";
+                    return 1;
+                }
+            }
+        }
+
+        float tailPeak = 0.0f;
+        for (int c = 0; c < 2; ++c)
+            for (int i = (kBlocks - 20) * kBs; i < kTotal; ++i)
+                tailPeak = juce::jmax (tailPeak, std::abs (out.getSample (c, i)));
+
+        if (linToDb ((double) tailPeak) > (double) kCeilingDb + 0.1)
+        {
+            std::cout << "reference_tests FAIL (wet path did not resume after bypass)\n";
+            return 1;
+        }
+    }
+
+    //// [CML:TEST] Offline Extended Oversampling Tier
+    // Nonrealtime 16x and 32x tiers must engage at their factor (latency above the 8x realtime tier, growing
+    // with the factor), stay finite and hold the ceiling; returning to realtime must restore the realtime latency.
+    // 32x is past the factor constructor's limit (stage-built chain): this render is its coverage.
+    int offlineTierLatency[3] = { 0, 0, 0 };
+    for (int offlineTier = 1; offlineTier <= 2; ++offlineTier)
+    {
+        constexpr double kSr = 48000.0;
+        constexpr int    kBs = 512;
+        constexpr double kOfflinePeakMarginDb = 0.5;
+        const int expectedFactor = (offlineTier == 1 ? 16 : 32);
+
+        CompassMasteringLimiterAudioProcessor procOff;
+        procOff.setPlayConfigDetails (2, 2, kSr, kBs);
+        setParamRaw (procOff, "drive", kDriveMaxDb);
+        setParamRaw (procOff, "ceiling", kCeilingHardDbTP);
+        setParamRaw (procOff, "oversampling_min", (float) kOversamplingMaxIndex);
+        setParamRaw (procOff, "oversampling_offline", (float) offlineTier);
+
+        procOff.prepareToPlay (kSr, kBs);
+        const int latencyRealtime = procOff.getLatencySamples();
+
+        procOff.setNonRealtime (true);
+
+        juce::AudioBuffer<float> b (2, kBs);
+        juce::MidiBuffer midi;
+        double phase = 0.0;
+        const double w = 2.0 * 3.14159265358979323846 * kProbeToneHz / kSr;
+        float peakSettled = 0.0f;
+
+        for (int k = 0; k < 32; ++k)
+        {
+            for (int i = 0; i < kBs; ++i)
+            {
+                const float s = (float) std::sin (phase) * kToneAmpLin;
+                phase += w;
+                b.setSample (0, i, s);
+                b.setSample (1, i, s);
+            }
+
+            procOff.processBlock (b, midi);
+            if (! bufferAllFinite (b))
+            {
+                std::cout << "reference_tests FAIL (offline " << expectedFactor << "x non-finite)\n";
+                return 1;
+            }
+
+            if (k >= 8)
+                peakSettled = std::max (peakSettled, bufferPeakAbs (b));
+        }
+
+        const int latencyOffline = procOff.getLatencySamples();
+        const int factorOffline = procOff.getActiveOversamplingFactor();
+        offlineTierLatency[offlineTier] = latencyOffline;
+
+        procOff.setNonRealtime (false);
+        b.clear();
+        procOff.processBlock (b, midi);
+        const int latencyBack = procOff.getLatencySamples();
+
+        procOff.releaseResources();
+
+        if (factorOffline != expectedFactor
+            || latencyOffline <= latencyRealtime || latencyBack != latencyRealtime
+            || latencyOffline <= offlineTierLatency[offlineTier - 1])
+        {
+            std::cout << "reference_tests DETAIL: offline tier " << expectedFactor << "x factor=" << factorOffline
+                      << " latency rt=" << latencyRealtime << " offline=" << latencyOffline << " back=" << latencyBack << "\n";
+            std::cout << "reference_tests FAIL (offline oversampling tier)\n";
+            return 1;
+        }
+
+        if ((double) peakSettled > dbToLin ((double) kCeilingHardDbTP + kOfflinePeakMarginDb))
+        {
+            std::cout << "reference_tests DETAIL: offline tier " << expectedFactor << "x peak="
+                      << linToDb ((double) peakSettled) << " dBFS\n";
+            std::cout << "reference_tests FAIL (offline oversampling ceiling)\n";
+            return 1;
+        }
+    }
+
+    //// [CML:TEST] Live Oversampling Switch
+    // Realtime, no transport edge: an Oversampling Min change must take effect mid-stream (shadow + crossfade),
+    // keep the reported latency fixed, and produce no step larger than the steady-state sample-to-sample slope.
+    // The overload scheduler is pinned to L0 (injected idle load) so the factors do not depend on this machine.
+    {
+        constexpr double kSr = 48000.0;
+        constexpr int    kBs = 512;
+        constexpr int    kBlocksPerPhase = 48;
+
+        CompassMasteringLimiterAudioProcessor procSw;
+        procSw.setPlayConfigDetails (2, 2, kSr, kBs);
+        setParamRaw (procSw, "drive", 6.0f);
+        setParamRaw (procSw, "ceiling", kCeilingHardDbTP);
+        setParamRaw (procSw, "stereo_link", 1.0f);
+        setParamRaw (procSw, "oversampling_min", 0.0f);
+        procSw.prepareToPlay (kSr, kBs);
+        procSw.setOverloadLoadOverride (0.0);
+
+        const int latency0 = procSw.getLatencySamples();
+
+        juce::AudioBuffer<float> b (2, kBs);
+        juce::MidiBuffer midi;
+        double phase = 0.0;
+        const double w = 2.0 * 3.14159265358979323846 * kProbeToneHz / kSr;
+        float prev = 0.0f;
+        bool finite = true;
+
+        auto runPhase = [&] (int blocks, int measureFrom) -> float
+        {
+            float maxStep = 0.0f;
+            for (int k = 0; k < blocks; ++k)
+            {
+                for (int i = 0; i < kBs; ++i)
+                {
+                    const float x = (float) std::sin (phase) * 0.9f;
+                    phase += w;
+                    b.setSample (0, i, x);
+                    b.setSample (1, i, x);
+                }
+
+                procSw.processBlock (b, midi);
+                finite = finite && bufferAllFinite (b);
+
+                for (int i = 0; i < kBs; ++i)
+                {
+                    const float y = b.getSample (0, i);
+                    if (k >= measureFrom)
+                        maxStep = std::max (maxStep, std::abs (y - prev));
+                    prev = y;
+                }
+            }
+            return maxStep;
+        };
+
+        const float stepSteady = runPhase (kBlocksPerPhase, kBlocksPerPhase / 2);
+        const int factorBefore = procSw.getActiveOversamplingFactor();
+
+        setParamRaw (procSw, "oversampling_min", (float) kOversamplingMaxIndex);
+        const float stepUp = runPhase (kBlocksPerPhase, 0);
+        const int factorUp = procSw.getActiveOversamplingFactor();
+
+        setParamRaw (procSw, "oversampling_min", 0.0f);
+        const float stepDown = runPhase (kBlocksPerPhase, 0);
+        const int factorDown = procSw.getActiveOversamplingFactor();
+
+        const int latency1 = procSw.getLatencySamples();
+        procSw.releaseResources();
+
+        const float stepLimit = stepSteady * 1.25f + 0.01f;
+        if (! finite || factorBefore != 2 || factorUp != 8 || factorDown != 2
+            || latency1 != latency0 || stepUp > stepLimit || stepDown > stepLimit)
+        {
+            std::cout << "reference_tests DETAIL: live OS switch factors " << factorBefore << "/" << factorUp << "/" << factorDown
+                      << " latency " << latency0 << "/" << latency1
+                      << " step steady=" << stepSteady << " up=" << stepUp << " down=" << stepDown << "\n";
+            std::cout << "reference_tests FAIL (live oversampling switch)\n";
+            return 1;
+        }
+    }
+
+    //// [CML:TEST] Transport Edge Reset Timing
+    // 64-sample blocks (housekeeping runs every 4th): transport start and stop edges placed off the housekeeping
+    // cadence must reset the envelopes on the edge block itself. Under sustained limiting the captured gain is
+    // deep right before the edge and back near unity on the edge block's first sample.
+    {
+        constexpr double kSr = 48000.0;
+        constexpr int    kBs = 64;
+        constexpr int    kBlocks = 96;
+        constexpr int    kStartBlock = 30; // 30 % 4 != 0; ~40 ms of limiting before the edge
+        constexpr int    kStopBlock  = 75; // 75 % 4 != 0; ~60 ms after the start reset
+        constexpr float  kDeepGainMax  = 0.5f;
+        constexpr float  kResetGainMin = 0.8f;
+
+        struct EdgePlayHead final : juce::AudioPlayHead
+        {
+            bool playing = false;
+
+            juce::Optional<PositionInfo> getPosition() const override
+            {
+                PositionInfo info;
+                info.setIsPlaying (playing);
+                return info;
+            }
+        };
+
+        CompassMasteringLimiterAudioProcessor procTr;
+        EdgePlayHead playHead;
+        procTr.setPlayHead (&playHead);
+        procTr.setPlayConfigDetails (2, 2, kSr, kBs);
+        setParamRaw (procTr, "drive", 12.0f);
+        setParamRaw (procTr, "ceiling", kCeilingHardDbTP);
+        setParamRaw (procTr, "stereo_link", 1.0f);
+        setParamRaw (procTr, "oversampling_min", 0.0f);
+        procTr.prepareToPlay (kSr, kBs);
+        procTr.setOverloadLoadOverride (0.0);
+
+        std::vector<float> gL ((size_t) (kBlocks * kBs), 1.0f), gR ((size_t) (kBlocks * kBs), 1.0f);
+        procTr.setGainCaptureTarget (gL.data(), gR.data(), kBlocks * kBs);
+
+        juce::AudioBuffer<float> b (2, kBs);
+        juce::MidiBuffer midi;
+        double phase = 0.0;
+        const double w = 2.0 * 3.14159265358979323846 * kProbeToneHz / kSr;
+
+        for (int k = 0; k < kBlocks; ++k)
+        {
+            if (k == kStartBlock) playHead.playing = true;
+            if (k == kStopBlock)  playHead.playing = false;
+
+            for (int i = 0; i < kBs; ++i)
+            {
+                const float s = (float) std::sin (phase) * 0.9f;
+                phase += w;
+                b.setSample (0, i, s);
+                b.setSample (1, i, s);
+            }
+            procTr.processBlock (b, midi);
+        }
+
+        procTr.setGainCaptureTarget (nullptr, nullptr, 0);
+        procTr.releaseResources();
+
+        bool ok = true;
+        for (int edge : { kStartBlock, kStopBlock })
+        {
+            const float before = gL[(size_t) (edge * kBs - 1)];
+            const float atEdge = gL[(size_t) (edge * kBs)];
+            std::cout << "reference_tests DETAIL: transport edge at block " << edge
+                      << " gain before=" << before << " at edge=" << atEdge << "\n";
+            ok = ok && (before < kDeepGainMax) && (atEdge > kResetGainMin);
+        }
+
+        if (! ok)
+        {
+            std::cout << "reference_tests FAIL (transport edge reset timing)\n";
+            return 1;
+        }
+    }
+
+    //// [CML:TEST] CPU Load Telemetry Snapshot
+    // Structural checks only (values are wall-clock derived): published, finite, ordered.
+    {
+        constexpr double kSr = 48000.0;
+        constexpr int    kBs = 256;
+
+        CompassMasteringLimiterAudioProcessor procCpu;
+        procCpu.setPlayConfigDetails (2, 2, kSr, kBs);
+        procCpu.attachMeterConsumer();
+        procCpu.prepareToPlay (kSr, kBs);
+
+        juce::AudioBuffer<float> b (2, kBs);
+        juce::MidiBuffer midi;
+        for (int k = 0; k < 64; ++k)
+        {
+            b.clear();
+            procCpu.processBlock (b, midi);
+        }
+
+        CompassMasteringLimiterAudioProcessor::CpuLoadStats cpu;
+        const bool published = procCpu.getCpuLoadStats (cpu);
+        procCpu.releaseResources();
+
+        if (! published
+            || ! std::isfinite ((double) cpu.p50) || ! std::isfinite ((double) cpu.p99) || ! std::isfinite ((double) cpu.max)
+            || cpu.p50 < 0.0f || cpu.p50 > cpu.p99
+            || cpu.overloadLevel < 0 || cpu.overloadLevel > 3
+            || cpu.assistActive != (cpu.overloadLevel > 0))
+        {
+            std::cout << "reference_tests FAIL (cpu load telemetry)\n";
+            return 1;
+        }
+
+        // Nonrealtime renders never degrade, regardless of how slow this machine is.
+        procCpu.setNonRealtime (true);
+        procCpu.prepareToPlay (kSr, kBs);
+        for (int k = 0; k < 64; ++k)
+        {
+            b.clear();
+            procCpu.processBlock (b, midi);
+        }
+
+        CompassMasteringLimiterAudioProcessor::CpuLoadStats cpuOff;
+        const bool publishedOff = procCpu.getCpuLoadStats (cpuOff);
+        procCpu.releaseResources();
+
+        if (! publishedOff || cpuOff.overloadLevel != 0 || cpuOff.overloadTransitions != 0u)
+        {
+            std::cout << "reference_tests FAIL (overload degradation in nonrealtime)\n";
+            return 1;
+        }
+    }
+
+    //// [CML:TEST] Overload Scheduler Levels
+    // Injected deadline ratios (setOverloadLoadOverride), one timed block per 256-sample host block.
+    // Down: strictly above 0.85 steps one level, then holds 64 timed blocks before the next step (max L3).
+    // Up: 256 consecutive blocks strictly below 0.50 step one level back; a block at 0.50 restarts the count.
+    // L3 lowers the oversampling factor one tier below Oversampling Min, so at Min = 2x it is a no-op.
+    // (Before the live-switch shadow path, L3 changed factor without a crossfade; see Live Oversampling Switch.)
+    {
+        constexpr double kSr = 48000.0;
+        constexpr int    kBs = 256;
+        constexpr int    kHold = 64;
+        constexpr int    kCalm = 256;
+
+        CompassMasteringLimiterAudioProcessor procOl;
+        procOl.setPlayConfigDetails (2, 2, kSr, kBs);
+        setParamRaw (procOl, "oversampling_min", 0.0f);
+        procOl.prepareToPlay (kSr, kBs);
+
+        juce::AudioBuffer<float> b (2, kBs);
+        juce::MidiBuffer midi;
+        auto run = [&] (double ratio, int blocks)
+        {
+            procOl.setOverloadLoadOverride (ratio);
+            for (int k = 0; k < blocks; ++k)
+            {
+                b.clear();
+                procOl.processBlock (b, midi);
+            }
+            return procOl.getOverloadLevel();
+        };
+
+        std::vector<int> got;
+        got.push_back (run (0.85, 8));          // at the down ratio: no step          -> 0
+        got.push_back (run (0.90, 1));          // above it: L1                        -> 1
+        got.push_back (run (0.90, kHold - 1));  // held                                -> 1
+        got.push_back (run (0.90, 1));          // hold expired: L2                    -> 2
+        got.push_back (run (0.90, kHold));      // L3                                  -> 3
+        got.push_back (run (0.99, 4 * kHold));  // capped                              -> 3
+        const int factorAtL3 = procOl.getActiveOversamplingFactor();
+        got.push_back (run (0.49, kCalm - 1));  // calm, one block short               -> 3
+        got.push_back (run (0.50, 1));          // at the up ratio: count restarts     -> 3
+        got.push_back (run (0.49, kCalm - 1));  //                                     -> 3
+        got.push_back (run (0.49, 1));          // L2                                  -> 2
+        got.push_back (run (0.60, 4 * kCalm));  // between the ratios: hold level      -> 2
+        got.push_back (run (0.49, 2 * kCalm));  // L1, L0                              -> 0
+        procOl.setOverloadLoadOverride (-1.0);
+        procOl.releaseResources();
+
+        const std::vector<int> expected { 0, 1, 1, 2, 3, 3, 3, 3, 3, 2, 2, 0 };
+        if (got != expected || factorAtL3 != 2)
+        {
+            std::cout << "reference_tests DETAIL: overload levels";
+            for (int l : got)
+                std::cout << " " << l;
+            std::cout << " (factor at L3 = " << factorAtL3 << "x)\n";
+            std::cout << "reference_tests FAIL (overload scheduler levels)\n";
+            return 1;
+        }
+
+        // Going offline without a fresh prepareToPlay: the realtime level must not carry into the bounce.
+        setParamRaw (procOl, "oversampling_min", 1.0f);
+        procOl.prepareToPlay (kSr, kBs);
+        const int levelRt = run (0.99, 3 * kHold);   // L3: one tier below Min (4x -> 2x)
+        procOl.setOverloadLoadOverride (-1.0);
+        procOl.setNonRealtime (true);
+        b.clear();
+        procOl.processBlock (b, midi);
+        const int levelOff  = procOl.getOverloadLevel();
+        const int factorOff = procOl.getActiveOversamplingFactor();
+        procOl.setNonRealtime (false);
+        procOl.releaseResources();
+
+        if (levelRt != 3 || levelOff != 0 || factorOff != 4)
+        {
+            std::cout << "reference_tests DETAIL: realtime level " << levelRt << ", offline level " << levelOff
+                      << " at " << factorOff << "x\n";
+            std::cout << "reference_tests FAIL (overload level carried into nonrealtime)\n";
+            return 1;
+        }
+    }
+
+    //// [CML:TEST] Meter Consumer Gating
+    // Without a consumer nothing is published and the audio is untouched; integrated loudness keeps
+    // accumulating, so a consumer attaching late reads the same integrated value as one attached throughout.
+    {
+        constexpr double kSr = 48000.0;
+        constexpr int    kBs = 512;
+        constexpr int    kDetachedBlocks = 40;
+        constexpr int    kBlocks = 60;
+        constexpr double kLufsTolDb = 0.01;
+
+        CompassMasteringLimiterAudioProcessor procA, procB;
+        for (auto* pp : { &procA, &procB })
+        {
+            pp->setPlayConfigDetails (2, 2, kSr, kBs);
+            setParamRaw (*pp, "drive", 0.0f);
+            setParamRaw (*pp, "ceiling", kCeilingHardDbTP);
+            pp->prepareToPlay (kSr, kBs);
+        }
+        procA.attachMeterConsumer();
+        procA.setMeterPublishRateHz (60);
+
+        juce::AudioBuffer<float> bA (2, kBs), bB (2, kBs);
+        juce::MidiBuffer midi;
+        const double w = 2.0 * 3.14159265358979323846 * kProbeToneHz / kSr;
+        bool identical = true;
+        bool publishedDetached = false;
+
+        for (int k = 0; k < kBlocks; ++k)
+        {
+            if (k == kDetachedBlocks)
+                procB.attachMeterConsumer();
+
+            for (int i = 0; i < kBs; ++i)
+            {
+                const float s = 0.5f * (float) std::sin (w * (double) (k * kBs + i));
+                bA.setSample (0, i, s);
+                bA.setSample (1, i, s);
+            }
+            bB.makeCopyOf (bA);
+
+            procA.processBlock (bA, midi);
+            procB.processBlock (bB, midi);
+
+            for (int c = 0; c < 2; ++c)
+                identical = identical && std::memcmp (bA.getReadPointer (c), bB.getReadPointer (c), sizeof (float) * (size_t) kBs) == 0;
+
+            float sDummy = 0.0f, iDummy = 0.0f;
+            if (k < kDetachedBlocks)
+                publishedDetached = publishedDetached || procB.getCurrentLufsDb (sDummy, iDummy);
+        }
+
+        float lufsSA = 0.0f, lufsIA = 0.0f, lufsSB = 0.0f, lufsIB = 0.0f;
+        const bool okA = procA.getCurrentLufsDb (lufsSA, lufsIA);
+        const bool okB = procB.getCurrentLufsDb (lufsSB, lufsIB);
+        procA.releaseResources();
+        procB.releaseResources();
+
+        if (! identical || publishedDetached || ! okA || ! okB
+            || std::abs ((double) lufsIA - (double) lufsIB) > kLufsTolDb)
+        {
+            std::cout << "reference_tests DETAIL: meter gating identical=" << identical << " publishedDetached=" << publishedDetached
+                      << " lufsI attached=" << lufsIA << " late=" << lufsIB << "\n";
+            std::cout << "reference_tests FAIL (meter consumer gating)\n";
+            return 1;
+        }
+    }
+
+    //// [CML:TEST] Meter Crest Transparency
+    // A quiet tone passes untouched, so the output crest must match the input crest at every oversampling
+    // tier: both sides accumulate once per native sample over the same publish period.
+    {
+        constexpr double kSr = 48000.0;
+        constexpr int    kBs = 512;
+        constexpr int    kBlocks = 100;
+        constexpr float  kAmp = 0.1f;
+        constexpr double kCrestTolDb = 0.5;
+
+        const double w = 2.0 * 3.14159265358979323846 * kProbeToneHz / kSr;
+
+        for (int osMin = 0; osMin < 3; ++osMin)
+        {
+            CompassMasteringLimiterAudioProcessor proc;
+            proc.setPlayConfigDetails (2, 2, kSr, kBs);
+            setParamRaw (proc, "drive", 0.0f);
+            setParamRaw (proc, "ceiling", kCeilingHardDbTP);
+            setParamRaw (proc, "oversampling_min", (float) osMin);
+            proc.prepareToPlay (kSr, kBs);
+            proc.attachMeterConsumer();
+
+            juce::AudioBuffer<float> b (2, kBs);
+            juce::MidiBuffer midi;
+            for (int k = 0; k < kBlocks; ++k)
+            {
+                for (int i = 0; i < kBs; ++i)
+                {
+                    const float s = kAmp * (float) std::sin (w * (double) (k * kBs + i));
+                    b.setSample (0, i, s);
+                    b.setSample (1, i, s);
+                }
+                proc.processBlock (b, midi);
+            }
+
+            float crestPre = 0.0f, crestPost = 0.0f;
+            const bool ok = proc.getCurrentCrestDb (crestPre, crestPost);
+            const int factor = proc.getActiveOversamplingFactor();
+            proc.detachMeterConsumer();
+            proc.releaseResources();
+
+            if (! ok || std::abs ((double) crestPost - (double) crestPre) > kCrestTolDb)
+            {
+                std::cout << "reference_tests DETAIL: crest pre=" << crestPre << " post=" << crestPost
+                          << " at " << factor << "x\n";
+                std::cout << "reference_tests FAIL (meter crest transparency)\n";
+                return 1;
+            }
+        }
+    }
+
+    //// [CML:TEST] Meter Drain Peak Preservation
+    // A burst in the first publish period must survive a consumer that reads only after several more
+    // snapshots: the drain returns each one, folds the burst into the aggregate, and leaves nothing unread.
+    // A latest-value getter polled after every block in between must not consume any of them.
+    {
+        constexpr double kSr = 48000.0;
+        constexpr int    kBs = 512;
+        constexpr int    kBlocks = 12;
+        constexpr int    kRateHz = 50;
+        constexpr float  kQuietAmp = 0.01f;
+        constexpr float  kBurstAmp = 0.5f;
+        constexpr double kMinBurstOverNewestDb = 20.0;
+
+        CompassMasteringLimiterAudioProcessor proc;
+        proc.setPlayConfigDetails (2, 2, kSr, kBs);
+        setParamRaw (proc, "drive", 0.0f);
+        setParamRaw (proc, "ceiling", kCeilingHardDbTP);
+        proc.prepareToPlay (kSr, kBs);
+        proc.attachMeterConsumer();
+        proc.setMeterPublishRateHz (kRateHz);
+
+        juce::AudioBuffer<float> b (2, kBs);
+        juce::MidiBuffer midi;
+        const double w = 2.0 * 3.14159265358979323846 * kProbeToneHz / kSr;
+        int polled = 0;
+
+        for (int k = 0; k < kBlocks; ++k)
+        {
+            const float amp = (k == 0 ? kBurstAmp : kQuietAmp);
+            for (int i = 0; i < kBs; ++i)
+            {
+                const float s = amp * (float) std::sin (w * (double) (k * kBs + i));
+                b.setSample (0, i, s);
+                b.setSample (1, i, s);
+            }
+            proc.processBlock (b, midi);
+
+            float inTp = 0.0f, outTp = 0.0f;
+            if (proc.getCurrentTruePeakDbTP (inTp, outTp))
+                ++polled;
+        }
+
+        const int expectedSnapshots = (kBlocks * kBs) / (int) (kSr / (double) kRateHz);
+
+        std::vector<CompassMasteringLimiterAudioProcessor::MeterHistoryPoint> points ((size_t) CompassMasteringLimiterAudioProcessor::kMeterRingCapacity);
+        CompassMasteringLimiterAudioProcessor::MeterDrain drain;
+        const int drained = proc.drainMeters (drain, points.data(), (int) points.size());
+
+        CompassMasteringLimiterAudioProcessor::MeterDrain drainAgain;
+        const int drainedAgain = proc.drainMeters (drainAgain, points.data() + drained, (int) points.size() - drained);
+
+        float historyMaxTp = -120.0f;
+        for (int n = 0; n < drained; ++n)
+            historyMaxTp = juce::jmax (historyMaxTp, points[(size_t) n].outTpDb);
+
+        const float aggOutTp = juce::jmax (drain.outTpDb[0], drain.outTpDb[1]);
+        const float newestTp = (drained > 0 ? points[(size_t) drained - 1].outTpDb : 0.0f);
+        proc.releaseResources();
+
+        if (polled == 0 || drained < expectedSnapshots - 1 || drained > expectedSnapshots + 1 || drainedAgain != 0
+            || aggOutTp != historyMaxTp || (double) (aggOutTp - newestTp) < kMinBurstOverNewestDb)
+        {
+            std::cout << "reference_tests DETAIL: meter drain count=" << drained << " expected=" << expectedSnapshots
+                      << " polled=" << polled << " again=" << drainedAgain << " aggOutTp=" << aggOutTp << " historyMax=" << historyMaxTp
+                      << " newest=" << newestTp << "\n";
+            std::cout << "reference_tests FAIL (meter drain peak preservation)\n";
+            return 1;
+        }
+    }
+
+    //// [CML:TEST] Meter Transport Tear-Free
+    // Every word of a published entry carries the same value: a torn copy would mix two publications.
+    // Single-threaded: readNext drains in order and skips what a full ring overwrote; readLatest before it
+    // does not consume anything.
+    {
+        struct Probe final { uint64_t w[24]; };
+        constexpr uint64_t kPublishes = 200000u;
+
+        static compass::SeqlockRing<Probe, 8> ring;
+        ring.reset();
+
+        std::thread producer ([&]
+        {
+            Probe p {};
+            for (uint64_t n = 1; n <= kPublishes; ++n)
+            {
+                for (auto& x : p.w) x = n;
+                ring.publish (p);
+            }
+        });
+
+        bool torn = false;
+        bool backwards = false;
+        uint64_t last = 0u;
+        while (last < kPublishes && ! torn)
+        {
+            Probe p {};
+            if (! ring.readNext (p))
+                continue;
+
+            for (const auto x : p.w)
+                torn = torn || (x != p.w[0]);
+
+            backwards = backwards || (p.w[0] <= last);
+            last = p.w[0];
+        }
+        producer.join();
+
+        ring.reset();
+        Probe p {};
+        for (uint64_t n = 1; n <= 20u; ++n)
+        {
+            for (auto& x : p.w) x = n;
+            ring.publish (p);
+        }
+
+        const bool polledOk = ring.readLatest (p) && p.w[0] == 20u;
+
+        uint64_t firstDrained = 0u, drained = 0u;
+        while (ring.readNext (p))
+        {
+            if (drained++ == 0u)
+                firstDrained = p.w[0];
+        }
+
+        const bool latestOk = ring.readLatest (p) && p.w[0] == 20u;
+
+        if (torn || backwards || firstDrained != 13u || drained != 8u || ! polledOk || ! latestOk)
+        {
+            std::cout << "reference_tests FAIL (meter transport torn=" << torn << " backwards=" << backwards
+                      << " firstDrained=" << firstDrained << " drained=" << drained << ")\n";
+            return 1;
+        }
+    }
+
+    //// [CML:TEST] Stage Profiling Counters
+    // Instrumented builds: every chain stage must be hit, and the per-sample breakdown is dumped.
+    // Default builds: hooks compile out, so the counters must stay untouched.
+    {
+        constexpr double kSr = 48000.0;
+        constexpr int    kBs = 512;
+
+        CompassMasteringLimiterAudioProcessor procProf;
+        procProf.setPlayConfigDetails (2, 2, kSr, kBs);
+        procProf.prepareToPlay (kSr, kBs);
+
+        procProf.resetStageCounters();
+
+        juce::AudioBuffer<float> b (2, kBs);
+        juce::MidiBuffer midi;
+        double phase = 0.0;
+        constexpr int kBlocks = 128;
+        for (int k = 0; k < kBlocks; ++k)
+        {
+            for (int i = 0; i < kBs; ++i)
+            {
+                const float v = 0.9f * (float) std::sin (phase);
+                phase += 2.0 * 3.14159265358979323846 * 997.0 / kSr;
+                b.setSample (0, i, v);
+                b.setSample (1, i, v);
+            }
+            procProf.processBlock (b, midi);
+        }
+        procProf.releaseResources();
+
+        const auto& prof = procProf.getStageCounters();
+        bool ok = true;
+        for (int st = 0; st < compass::kStageCount; ++st)
+        {
+            const auto hits = prof.hits[(size_t) st];
+            ok = ok && (compass::kStageProfilingEnabled ? (hits > 0u) : (hits == 0u && prof.ticks[(size_t) st] == 0u));
+        }
+
+        if (compass::kStageProfilingEnabled)
+        {
+            const double nativeSamples = (double) kBlocks * (double) kBs;
+            std::cout << "reference_tests DETAIL: stage profile (" << (compass::stageTicksAreCycles() ? "cycles" : "ns") << " per native sample)";
+            for (int st = 0; st < compass::kStageCount; ++st)
+                std::cout << " " << compass::stageName ((compass::Stage) st) << "=" << (double) prof.ticks[(size_t) st] / nativeSamples;
+            std::cout << "\n";
+        }
+
+        if (! ok)
+        {
+            std::cout << "reference_tests FAIL (stage profiling counters)\n";
+            return 1;
+        }
+    }
+
+    //// [CML:TEST] Anomaly Flight Recorder
+    // A non-finite input trips badMathThisBlock; the frozen window must be dumpable (synchronously, no writer
+    // thread) with the trigger recorded, and a dump must consume the pending window.
+    // Overload-assist dumps are wall-clock driven, so any pending one is drained (not asserted) beforehand.
+    // The recorder is opt-in: a default instance must record and dump nothing for the same input.
+    {
+        constexpr double kSr = 48000.0;
+        constexpr int    kBs = 256;
+
+        const auto dumpDir = juce::File::getSpecialLocation (juce::File::tempDirectory).getChildFile ("cml_reference_tests_flight");
+        dumpDir.deleteRecursively();
+
+        CompassMasteringLimiterAudioProcessor procFr;
+        procFr.enableFlightRecorder (dumpDir, false);
+        procFr.setPlayConfigDetails (2, 2, kSr, kBs);
+        procFr.prepareToPlay (kSr, kBs);
+
+        juce::AudioBuffer<float> b (2, kBs);
+        juce::MidiBuffer midi;
+        double phase = 0.0;
+        const double w = 2.0 * 3.14159265358979323846 * kProbeToneHz / kSr;
+
+        auto fillTone = [&b, &phase, w]
+        {
+            for (int i = 0; i < b.getNumSamples(); ++i)
+            {
+                const float v = 0.5f * (float) std::sin (phase);
+                phase += w;
+                b.setSample (0, i, v);
+                b.setSample (1, i, v);
+            }
+        };
+
+        for (int k = 0; k < 16; ++k)
+        {
+            fillTone();
+            procFr.processBlock (b, midi);
+        }
+
+        procFr.writePendingFlightRecord();
+
+        fillTone();
+        b.setSample (0, kBs / 2, std::numeric_limits<float>::quiet_NaN());
+        procFr.processBlock (b, midi);
+
+        const juce::File dump = procFr.writePendingFlightRecord();
+        const juce::String text = dump.loadFileAsString();
+        const bool consumed = (procFr.writePendingFlightRecord() == juce::File());
+        const int dumps = procFr.getFlightRecordCount();
+
+        procFr.releaseResources();
+
+        CompassMasteringLimiterAudioProcessor procDefault;
+        procDefault.setPlayConfigDetails (2, 2, kSr, kBs);
+        procDefault.prepareToPlay (kSr, kBs);
+        fillTone();
+        b.setSample (0, kBs / 2, std::numeric_limits<float>::quiet_NaN());
+        procDefault.processBlock (b, midi);
+        const bool defaultSilent = (procDefault.writePendingFlightRecord() == juce::File())
+                                   && procDefault.getFlightRecordCount() == 0;
+        procDefault.releaseResources();
+
+        dumpDir.deleteRecursively();
+
+        if (! defaultSilent)
+        {
+            std::cout << "reference_tests FAIL (flight recorder not opt-in)\n";
+            return 1;
+        }
+
+        if (! consumed || dumps < 1
+            || ! text.startsWith ("# trigger=nonfinite")
+            || juce::StringArray::fromLines (text).size() < 2 + kBs)
+        {
+            std::cout << "reference_tests DETAIL: flight recorder consumed=" << (consumed ? 1 : 0) << " dumps=" << dumps << "\n";
+            std::cout << "reference_tests FAIL (anomaly flight recorder)\n";
+            return 1;
+        }
+    }
+
+    //// [CML:TEST] Audio Thread Realtime Safety (B006)
+    // Every processBlock call runs armed: any operator new/delete / malloc / free / pthread_mutex_lock on the
+    // calling thread fails the run. Covers SR x block x OS, transport-edge reset(), oversampling boundary
+    // switches, the double overload and the nonrealtime boundary. Setup/teardown runs unarmed.
+    {
+        audio_thread_guard::install();
+
+        struct EdgePlayHead final : juce::AudioPlayHead
+        {
+            bool playing = false;
+
+            juce::Optional<PositionInfo> getPosition() const override
+            {
+                PositionInfo info;
+                info.setIsPlaying (playing);
+                return info;
+            }
+        };
+
+        const double rtSampleRates[] = { 44100.0, 48000.0, 96000.0, 192000.0 };
+        const int    rtBlockSizes[]  = { 16, 64, 256, 1024, 4096 };
+        constexpr int kRtBlocks = 12;
+
+        bool rtFailed = false;
+
+        auto checkArmed = [&rtFailed] (const audio_thread_guard::Counts& c, const char* what, double sr, int bs, int os)
+        {
+            if (c.clean())
+                return;
+
+            rtFailed = true;
+            std::cout << "reference_tests DETAIL: audio thread " << what << " sr=" << (int) sr << " bs=" << bs << " os=" << os
+                      << " new=" << c.newCalls << " malloc=" << c.mallocCalls << " delete=" << c.deleteCalls
+                      << " free=" << c.freeCalls << " lock=" << c.lockCalls << "\n";
+        };
+
+        for (double sr : rtSampleRates)
+        {
+            for (int bs : rtBlockSizes)
+            {
+                for (int os = 0; os <= kOversamplingMaxIndex && ! rtFailed; ++os)
+                {
+                    CompassMasteringLimiterAudioProcessor procRt;
+                    EdgePlayHead playHead;
+                    procRt.setPlayHead (&playHead);
+                    procRt.setPlayConfigDetails (2, 2, sr, bs);
+                    setParamRaw (procRt, "drive", kDriveMaxDb);
+                    setParamRaw (procRt, "ceiling", kCeilingHardDbTP);
+                    setParamRaw (procRt, "oversampling_min", (float) os);
+                    procRt.prepareToPlay (sr, bs);
+
+                    juce::AudioBuffer<float>  b (2, bs);
+                    juce::AudioBuffer<double> bd (2, bs);
+                    juce::MidiBuffer midi;
+                    double phase = 0.0;
+                    const double w = 2.0 * 3.14159265358979323846 * kProbeToneHz / sr;
+
+                    for (int k = 0; k < kRtBlocks; ++k)
+                    {
+                        for (int i = 0; i < bs; ++i)
+                        {
+                            const float v = (float) std::sin (phase) * kToneAmpLin;
+                            phase += w;
+                            b.setSample (0, i, v);
+                            b.setSample (1, i, v);
+                            bd.setSample (0, i, (double) v);
+                            bd.setSample (1, i, (double) v);
+                        }
+
+                        // Transport edges: k=4 start (reset), k=8 stop with a different OS tier latched at the boundary.
+                        if (k == 4)
+                            playHead.playing = true;
+                        if (k == 8)
+                        {
+                            setParamRaw (procRt, "oversampling_min", (float) ((os + 1) % (kOversamplingMaxIndex + 1)));
+                            playHead.playing = false;
+                        }
+
+                        audio_thread_guard::Counts c;
+                        {
+                            audio_thread_guard::ScopedArm armed (c);
+                            if ((k & 1) == 0)
+                                procRt.processBlock (b, midi);
+                            else
+                                procRt.processBlock (bd, midi);
+                        }
+                        checkArmed (c, "processBlock", sr, bs, os);
+                    }
+
+                    procRt.setPlayHead (nullptr);
+                    procRt.releaseResources();
+                }
+            }
+        }
+
+        // Nonrealtime boundary (offline tier engaged at the block boundary; tier itself built unarmed).
+        if (! rtFailed)
+        {
+            constexpr double kSr = 48000.0;
+            constexpr int    kBs = 512;
+
+            CompassMasteringLimiterAudioProcessor procNr;
+            procNr.setPlayConfigDetails (2, 2, kSr, kBs);
+            setParamRaw (procNr, "drive", kDriveMaxDb);
+            setParamRaw (procNr, "oversampling_offline", 2.0f);
+            procNr.prepareToPlay (kSr, kBs);
+
+            juce::AudioBuffer<float> b (2, kBs);
+            juce::MidiBuffer midi;
+
+            for (int k = 0; k < 8; ++k)
+            {
+                if (k == 2) procNr.setNonRealtime (true);
+                if (k == 6) procNr.setNonRealtime (false);
+
+                for (int i = 0; i < kBs; ++i)
+                {
+                    const float v = kToneAmpLin * (float) std::sin (2.0 * 3.14159265358979323846 * kProbeToneHz * (double) (k * kBs + i) / kSr);
+                    b.setSample (0, i, v);
+                    b.setSample (1, i, v);
+                }
+
+                audio_thread_guard::Counts c;
+                {
+                    audio_thread_guard::ScopedArm armed (c);
+                    procNr.processBlock (b, midi);
+                }
+                checkArmed (c, "nonrealtime boundary", kSr, kBs, -1);
+            }
+
+            procNr.releaseResources();
+        }
+
+        if (rtFailed)
+        {
+            std::cout << "reference_tests FAIL (audio thread allocation/lock)\n";
+            return 1;
+        }
+    }
+
     std::cout << "reference_tests PASS\n";
     return 0;
 }